@@ -19,8 +19,8 @@ std::unique_ptr<BoundRegularQuery> Binder::bindQuery(const RegularQuery& regular
         boundSingleQueries[0]->hasReturnClause() ?
             boundSingleQueries[0]->getReturnClause()->getStatementResult()->copy() :
             BoundStatementResult::createEmptyResult();
-    auto boundRegularQuery = std::make_unique<BoundRegularQuery>(
-        regularQuery.getIsUnionAll(), std::move(statementResult));
+    auto boundRegularQuery = std::make_unique<BoundRegularQuery>(regularQuery.getIsUnionAll(),
+        regularQuery.getIdenticalSingleQueryIdxes(), std::move(statementResult));
     for (auto& boundSingleQuery : boundSingleQueries) {
         auto normalizedSingleQuery = QueryNormalizer::normalizeQuery(*boundSingleQuery);
         validateReadNotFollowUpdate(*normalizedSingleQuery);
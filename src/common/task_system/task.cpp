@@ -1,5 +1,7 @@
 #include "common/task_system/task.h"
 
+#include <algorithm>
+
 namespace kuzu {
 namespace common {
 
@@ -14,11 +16,63 @@ bool Task::registerThread() {
     return false;
 }
 
+bool Task::requestThreadToYield() {
+    lock_t lck{mtx};
+    auto numRunningThreads = numThreadsRegistered - numThreadsFinished - yieldedThreads.size();
+    if (!canYield() || hasExceptionNoLock() || numThreadsFinished > 0 ||
+        numThreadsToYield.load() >= numRunningThreads) {
+        return false;
+    }
+    numThreadsToYield++;
+    return true;
+}
+
+bool Task::yieldThreadIfRequestedSlow() {
+    lock_t lck{mtx};
+    // Once a thread has finished, there is no work left for other threads to pick up.
+    if (numThreadsToYield.load() == 0 || numThreadsFinished > 0) {
+        return false;
+    }
+    numThreadsToYield--;
+    yieldedThreads.push_back(std::this_thread::get_id());
+    return true;
+}
+
 void Task::deRegisterThreadAndFinalizeTaskIfNecessary() {
     lock_t lck{mtx};
+    auto it = std::find(yieldedThreads.begin(), yieldedThreads.end(), std::this_thread::get_id());
+    if (it != yieldedThreads.end()) {
+        yieldedThreads.erase(it);
+        // A task with an exception or a finished thread no longer accepts workers, so the
+        // yielded thread finishes it like any other thread.
+        if (numThreadsFinished == 0 && !hasExceptionNoLock()) {
+            --numThreadsRegistered;
+            if (numThreadsRegistered == 0) {
+                numThreadsToYield = 0;
+            }
+            return;
+        }
+    }
     ++numThreadsFinished;
-    if (!hasExceptionNoLock() && isCompletedNoLock()) {
-        finalizeIfNecessary();
+    // The remaining threads finish their last morsels instead of yielding.
+    numThreadsToYield = 0;
+    if (isCompletedNoLock()) {
+        if (!hasExceptionNoLock()) {
+            finalizeIfNecessary();
+        }
+        completedOrErrored.notify_all();
+    }
+}
+
+void Task::waitUntilCompleted(bool stopOnException, uint64_t maxWaitTimeInMicros) {
+    lock_t lck{mtx};
+    auto isDone = [&] {
+        return isCompletedNoLock() || (stopOnException && hasExceptionNoLock());
+    };
+    if (maxWaitTimeInMicros == 0) {
+        completedOrErrored.wait(lck, isDone);
+    } else {
+        completedOrErrored.wait_for(lck, std::chrono::microseconds(maxWaitTimeInMicros), isDone);
     }
 }
 
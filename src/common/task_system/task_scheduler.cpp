@@ -1,5 +1,7 @@
 #include "common/task_system/task_scheduler.h"
 
+#include <algorithm>
+
 #include "common/constants.h"
 #include "spdlog/spdlog.h"
 
@@ -9,15 +11,18 @@ namespace kuzu {
 namespace common {
 
 TaskScheduler::TaskScheduler(uint64_t numThreads)
-    : logger{LoggerUtils::getLogger(LoggerConstants::LoggerEnum::PROCESSOR)}, nextScheduledTaskID{
-                                                                                  0} {
+    : logger{LoggerUtils::getLogger(LoggerConstants::LoggerEnum::PROCESSOR)}, numIdleWorkers{0},
+      nextScheduledTaskID{0} {
     for (auto n = 0u; n < numThreads; ++n) {
         threads.emplace_back([&] { runWorkerThread(); });
     }
 }
 
 TaskScheduler::~TaskScheduler() {
+    lock_t lck{mtx};
     stopThreads.store(true);
+    taskScheduled.notify_all();
+    lck.unlock();
     for (auto& thread : threads) {
         thread.join();
     }
@@ -27,9 +32,37 @@ std::shared_ptr<ScheduledTask> TaskScheduler::scheduleTask(const std::shared_ptr
     lock_t lck{mtx};
     auto scheduledTask = std::make_shared<ScheduledTask>(task, nextScheduledTaskID++);
     taskQueue.push_back(scheduledTask);
+    requestThreadsToYieldNoLock(task);
+    taskScheduled.notify_all();
     return scheduledTask;
 }
 
+// Asks running tasks of lower priority to yield the threads that the given task can use but idle
+// workers cannot provide. Threads are taken from the lowest priority tasks first.
+void TaskScheduler::requestThreadsToYieldNoLock(const std::shared_ptr<Task>& task) {
+    auto numThreadsToFree = std::min<uint64_t>(task->getMaxNumThreads(), threads.size());
+    if (numThreadsToFree <= numIdleWorkers) {
+        return;
+    }
+    numThreadsToFree -= numIdleWorkers;
+    std::vector<std::shared_ptr<Task>> tasksToYield;
+    for (auto& scheduledTask : taskQueue) {
+        if (scheduledTask->task->getPriority() < task->getPriority() &&
+            scheduledTask->task->canYield()) {
+            tasksToYield.push_back(scheduledTask->task);
+        }
+    }
+    std::stable_sort(tasksToYield.begin(), tasksToYield.end(),
+        [](const std::shared_ptr<Task>& left, const std::shared_ptr<Task>& right) {
+            return left->getPriority() < right->getPriority();
+        });
+    for (auto& taskToYield : tasksToYield) {
+        while (numThreadsToFree > 0 && taskToYield->requestThreadToYield()) {
+            numThreadsToFree--;
+        }
+    }
+}
+
 void TaskScheduler::errorIfThereIsAnException() {
     lock_t lck{mtx};
     errorIfThereIsAnExceptionNoLock();
@@ -49,17 +82,19 @@ void TaskScheduler::errorIfThereIsAnExceptionNoLock() {
     }
 }
 
-void TaskScheduler::waitAllTasksToCompleteOrError() {
-    while (true) {
-        lock_t lck{mtx};
-        if (taskQueue.empty()) {
-            return;
+bool TaskScheduler::hasExceptionNoLock() {
+    for (auto& scheduledTask : taskQueue) {
+        if (scheduledTask->task->hasException()) {
+            return true;
         }
-        errorIfThereIsAnExceptionNoLock();
-        lck.unlock();
-        std::this_thread::sleep_for(
-            std::chrono::microseconds(THREAD_SLEEP_TIME_WHEN_WAITING_IN_MICROS));
     }
+    return false;
+}
+
+void TaskScheduler::waitAllTasksToCompleteOrError() {
+    lock_t lck{mtx};
+    taskFinished.wait(lck, [&] { return taskQueue.empty() || hasExceptionNoLock(); });
+    errorIfThereIsAnExceptionNoLock();
 }
 
 void TaskScheduler::scheduleTaskAndWaitOrError(
@@ -71,83 +106,134 @@ void TaskScheduler::scheduleTaskAndWaitOrError(
     while (!task->isCompleted()) {
         if (context != nullptr && context->clientContext->isTimeOutEnabled()) {
             interruptTaskIfTimeOutNoLock(context);
+            // Wake up periodically to check for time out. Completion still wakes us up early.
+            task->waitUntilCompleted(
+                false /* stopOnException */, THREAD_SLEEP_TIME_WHEN_WAITING_IN_MICROS);
         } else if (task->hasException()) {
             // Interrupt tasks that errored, so other threads can stop working on them early.
-            context->clientContext->interrupt();
+            if (context != nullptr) {
+                context->clientContext->interrupt();
+            }
+            task->waitUntilCompleted(false /* stopOnException */);
+        } else {
+            task->waitUntilCompleted(true /* stopOnException */);
         }
-        std::this_thread::sleep_for(
-            std::chrono::microseconds(THREAD_SLEEP_TIME_WHEN_WAITING_IN_MICROS));
     }
+    // The task is completed, but the last worker may not have removed it from the queue yet.
+    removeTask(scheduledTask->ID);
     if (task->hasException()) {
-        removeErroringTask(scheduledTask->ID);
         std::rethrow_exception(task->getExceptionPtr());
     }
 }
 
 void TaskScheduler::waitUntilEnoughTasksFinish(int64_t minimumNumTasksToScheduleMore) {
-    while (getNumTasks() > minimumNumTasksToScheduleMore) {
-        errorIfThereIsAnException();
-        std::this_thread::sleep_for(
-            std::chrono::microseconds(THREAD_SLEEP_TIME_WHEN_WAITING_IN_MICROS));
-    }
+    lock_t lck{mtx};
+    taskFinished.wait(lck, [&] {
+        return (int64_t)taskQueue.size() <= minimumNumTasksToScheduleMore || hasExceptionNoLock();
+    });
+    errorIfThereIsAnExceptionNoLock();
 }
 
-std::shared_ptr<ScheduledTask> TaskScheduler::getTaskAndRegister() {
-    lock_t lck{mtx};
-    if (taskQueue.empty()) {
-        return nullptr;
-    }
-    auto it = taskQueue.begin();
-    while (it != taskQueue.end()) {
-        auto task = (*it)->task;
-        if (!task->registerThread()) {
-            // If we cannot register for a thread it is because of three possibilities:
-            // (i) maximum number of threads have registered for task and the task is completed
-            // without an exception; or (ii) same as (i) but the task has not yet successfully
-            // completed; or (iii) task has an exception; Only in (i) we remove the task from the
-            // queue. For (ii) and (iii) we keep the task in queue. Recall erroring tasks need to be
-            // manually removed.
-            if (task->isCompletedSuccessfully()) { // option (i)
-                it = taskQueue.erase(it);
-            } else { // option (ii) or (iii): keep the task in the queue.
-                ++it;
+// A task stops accepting threads once one of its threads finishes, so a worker can only choose
+// among tasks whose threads are all still running. Among those, it registers to the task with the
+// highest priority and then the fewest threads, breaking ties in FIFO order. This matters when
+// workers are freed while several tasks wait, e.g., when a long running task of one connection
+// finishes while queries of other connections are queued: the freed workers are spread over the
+// queued tasks instead of all registering to the first one.
+std::shared_ptr<ScheduledTask> TaskScheduler::getTaskAndRegisterNoLock() {
+    while (true) {
+        std::shared_ptr<ScheduledTask> taskToRegister = nullptr;
+        uint64_t maxPriority = 0;
+        auto minNumThreads = UINT64_MAX;
+        auto it = taskQueue.begin();
+        while (it != taskQueue.end()) {
+            auto task = (*it)->task;
+            if (!task->canRegisterThread()) {
+                // If we cannot register for a thread it is because of three possibilities:
+                // (i) maximum number of threads have registered for task and the task is completed
+                // without an exception; or (ii) same as (i) but the task has not yet successfully
+                // completed; or (iii) task has an exception; Only in (i) we remove the task from
+                // the queue. For (ii) and (iii) we keep the task in queue. Recall erroring tasks
+                // need to be manually removed.
+                if (task->isCompletedSuccessfully()) { // option (i)
+                    it = taskQueue.erase(it);
+                } else { // option (ii) or (iii): keep the task in the queue.
+                    ++it;
+                }
+                continue;
             }
-        } else {
-            return *it;
+            auto priority = task->getPriority();
+            auto numThreads = task->getNumThreadsRegistered();
+            if (taskToRegister == nullptr || priority > maxPriority ||
+                (priority == maxPriority && numThreads < minNumThreads)) {
+                maxPriority = priority;
+                minNumThreads = numThreads;
+                taskToRegister = *it;
+            }
+            ++it;
+        }
+        if (taskToRegister == nullptr) {
+            return nullptr;
+        }
+        if (taskToRegister->task->registerThread()) {
+            return taskToRegister;
         }
+        // The task has errored after we checked it, so we look for another task.
     }
-    return nullptr;
 }
 
-void TaskScheduler::removeErroringTask(uint64_t scheduledTaskID) {
+void TaskScheduler::removeTask(uint64_t scheduledTaskID) {
     lock_t lck{mtx};
     for (auto it = taskQueue.begin(); it != taskQueue.end(); ++it) {
         if (scheduledTaskID == (*it)->ID) {
             taskQueue.erase(it);
+            taskFinished.notify_all();
             return;
         }
     }
 }
 
+// Removes a successfully completed task from the queue and wakes up users waiting on tasks to
+// finish. Erroring tasks are kept in the queue until they are removed by the waiting user. A task
+// that a thread yielded accepts workers again, so idle workers are woken up.
+void TaskScheduler::finishTask(const std::shared_ptr<ScheduledTask>& scheduledTask) {
+    lock_t lck{mtx};
+    if (scheduledTask->task->isCompletedSuccessfully()) {
+        auto it = std::find(taskQueue.begin(), taskQueue.end(), scheduledTask);
+        if (it != taskQueue.end()) {
+            taskQueue.erase(it);
+        }
+    } else if (scheduledTask->task->canRegisterThread()) {
+        taskScheduled.notify_all();
+    }
+    taskFinished.notify_all();
+}
+
 void TaskScheduler::runWorkerThread() {
     while (true) {
-        if (stopThreads.load()) {
+        lock_t lck{mtx};
+        std::shared_ptr<ScheduledTask> scheduledTask;
+        numIdleWorkers++;
+        taskScheduled.wait(lck, [&] {
+            if (stopThreads.load()) {
+                return true;
+            }
+            scheduledTask = getTaskAndRegisterNoLock();
+            return scheduledTask != nullptr;
+        });
+        numIdleWorkers--;
+        lck.unlock();
+        if (!scheduledTask) { // Stopping.
             break;
         }
-        auto scheduledTask = getTaskAndRegister();
-        if (!scheduledTask) {
-            std::this_thread::sleep_for(
-                std::chrono::microseconds(THREAD_SLEEP_TIME_WHEN_WAITING_IN_MICROS));
-            continue;
-        }
         try {
             scheduledTask->task->run();
             scheduledTask->task->deRegisterThreadAndFinalizeTaskIfNecessary();
         } catch (std::exception& e) {
             scheduledTask->task->setException(std::current_exception());
             scheduledTask->task->deRegisterThreadAndFinalizeTaskIfNecessary();
-            continue;
         }
+        finishTask(scheduledTask);
     }
 }
 
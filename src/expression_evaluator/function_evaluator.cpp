@@ -28,6 +28,9 @@ void FunctionExpressionEvaluator::evaluate() {
 }
 
 bool FunctionExpressionEvaluator::select(SelectionVector& selVector) {
+    if (canSelectConjunctively(selVector)) {
+        return selectConjunctively(selVector);
+    }
     for (auto& child : children) {
         child->evaluate();
     }
@@ -49,6 +52,49 @@ bool FunctionExpressionEvaluator::select(SelectionVector& selVector) {
     return selectFunc(parameters, selVector);
 }
 
+// Conjuncts can be selected one after another only if selecting a conjunct narrows the input of
+// the next one, i.e. each unflat child is evaluated on the state that owns selVector. If all
+// children are flat, there is nothing to narrow.
+bool FunctionExpressionEvaluator::canSelectConjunctively(const SelectionVector& selVector) const {
+    if (expression->expressionType != AND || isResultFlat()) {
+        return false;
+    }
+    for (auto& child : children) {
+        if (!child->isResultFlat() && child->resultVector->state->selVector.get() != &selVector) {
+            return false;
+        }
+    }
+    return true;
+}
+
+// Selects the left conjunct into selVector and then the right conjunct on the surviving positions
+// only. Compared to evaluating both conjuncts and combining them, this avoids materializing the
+// intermediate boolean vectors and skips the right conjunct for positions that are already
+// filtered out. A flat conjunct does not depend on the positions in selVector, so it is evaluated
+// once and either keeps or rejects all of them.
+bool FunctionExpressionEvaluator::selectConjunctively(SelectionVector& selVector) {
+    for (auto& child : children) {
+        if (child->isResultFlat()) {
+            child->evaluate();
+            auto& result = *child->resultVector;
+            auto pos = result.state->selVector->selectedPositions[0];
+            if (result.isNull(pos) || !result.getValue<bool>(pos)) {
+                return false;
+            }
+            continue;
+        }
+        if (!child->select(selVector)) {
+            return false;
+        }
+        if (selVector.isUnfiltered()) {
+            // Unflat select functions write into the selected positions buffer, so the next
+            // conjunct must read positions from it.
+            selVector.resetSelectorToValuePosBuffer();
+        }
+    }
+    return true;
+}
+
 std::unique_ptr<BaseExpressionEvaluator> FunctionExpressionEvaluator::clone() {
     std::vector<std::unique_ptr<BaseExpressionEvaluator>> clonedChildren;
     for (auto& child : children) {
@@ -1,5 +1,6 @@
 #include "function/aggregate/aggregate_function.h"
 
+#include "function/aggregate/approx_count_distinct.h"
 #include "function/aggregate/avg.h"
 #include "function/aggregate/collect.h"
 #include "function/aggregate/count.h"
@@ -101,6 +102,46 @@ std::unique_ptr<AggregateFunction> AggregateFunctionUtil::getCollectFunction(
         CollectFunction::finalize, inputType, isDistinct);
 }
 
+std::unique_ptr<AggregateFunction> AggregateFunctionUtil::getApproxCountDistinctFunction(
+    const DataType& inputType) {
+    switch (inputType.typeID) {
+    case INTERNAL_ID:
+        return getApproxCountDistinctFunction<internalID_t>(inputType);
+    case BOOL:
+        return getApproxCountDistinctFunction<bool>(inputType);
+    case INT64:
+        return getApproxCountDistinctFunction<int64_t>(inputType);
+    case INT32:
+        return getApproxCountDistinctFunction<int32_t>(inputType);
+    case INT16:
+        return getApproxCountDistinctFunction<int16_t>(inputType);
+    case DOUBLE:
+        return getApproxCountDistinctFunction<double_t>(inputType);
+    case FLOAT:
+        return getApproxCountDistinctFunction<float_t>(inputType);
+    case STRING:
+        return getApproxCountDistinctFunction<ku_string_t>(inputType);
+    case DATE:
+        return getApproxCountDistinctFunction<date_t>(inputType);
+    case TIMESTAMP:
+        return getApproxCountDistinctFunction<timestamp_t>(inputType);
+    case INTERVAL:
+        return getApproxCountDistinctFunction<interval_t>(inputType);
+    default:
+        throw RuntimeException("Unsupported input data type " + Types::dataTypeToString(inputType) +
+                               " for AggregateFunctionUtil::getApproxCountDistinctFunction.");
+    }
+}
+
+template<typename T>
+std::unique_ptr<AggregateFunction> AggregateFunctionUtil::getApproxCountDistinctFunction(
+    const DataType& inputType) {
+    return std::make_unique<AggregateFunction>(ApproxCountDistinctFunction<T>::initialize,
+        ApproxCountDistinctFunction<T>::updateAll, ApproxCountDistinctFunction<T>::updatePos,
+        ApproxCountDistinctFunction<T>::combine, ApproxCountDistinctFunction<T>::finalize,
+        inputType);
+}
+
 template<typename FUNC>
 std::unique_ptr<AggregateFunction> AggregateFunctionUtil::getMinMaxFunction(
     const DataType& inputType, bool isDistinct) {
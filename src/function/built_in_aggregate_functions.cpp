@@ -73,6 +73,7 @@ void BuiltInAggregateFunctions::registerAggregateFunctions() {
     registerMin();
     registerMax();
     registerCollect();
+    registerApproxCountDistinct();
 }
 
 void BuiltInAggregateFunctions::registerCountStar() {
@@ -155,5 +156,17 @@ void BuiltInAggregateFunctions::registerCollect() {
     aggregateFunctions.insert({COLLECT_FUNC_NAME, std::move(definitions)});
 }
 
+void BuiltInAggregateFunctions::registerApproxCountDistinct() {
+    std::vector<std::unique_ptr<AggregateFunctionDefinition>> definitions;
+    for (auto typeID : std::vector<DataTypeID>{INTERNAL_ID, BOOL, INT64, INT32, INT16, DOUBLE,
+             FLOAT, STRING, DATE, TIMESTAMP, INTERVAL}) {
+        definitions.push_back(std::make_unique<AggregateFunctionDefinition>(
+            APPROX_COUNT_DISTINCT_FUNC_NAME, std::vector<DataTypeID>{typeID}, INT64,
+            AggregateFunctionUtil::getApproxCountDistinctFunction(DataType(typeID)),
+            false /* isDistinct */));
+    }
+    aggregateFunctions.insert({APPROX_COUNT_DISTINCT_FUNC_NAME, std::move(definitions)});
+}
+
 } // namespace function
 } // namespace kuzu
@@ -19,6 +19,8 @@ public:
         value->setDataType(targetType);
     }
 
+    inline std::string getParameterName() const { return parameterName; }
+
     inline std::shared_ptr<common::Value> getLiteral() const { return value; }
 
     std::string toString() const override { return "$" + parameterName; }
@@ -8,10 +8,12 @@ namespace binder {
 
 class BoundRegularQuery : public BoundStatement {
 public:
-    explicit BoundRegularQuery(
-        std::vector<bool> isUnionAll, std::unique_ptr<BoundStatementResult> statementResult)
+    explicit BoundRegularQuery(std::vector<bool> isUnionAll,
+        std::vector<uint32_t> identicalSingleQueryIdxes,
+        std::unique_ptr<BoundStatementResult> statementResult)
         : BoundStatement{common::StatementType::QUERY, std::move(statementResult)},
-          isUnionAll{std::move(isUnionAll)} {}
+          isUnionAll{std::move(isUnionAll)}, identicalSingleQueryIdxes{
+                                                 std::move(identicalSingleQueryIdxes)} {}
 
     ~BoundRegularQuery() override = default;
 
@@ -34,9 +36,17 @@ public:
 
     inline bool getIsUnionAll(uint32_t idx) const { return isUnionAll[idx]; }
 
+    // Returns the index of the first single query that is identical to the idx-th single query.
+    // Read-only identical single queries are evaluated only once.
+    inline uint32_t getIdenticalSingleQueryIdx(uint32_t idx) const {
+        auto identicalIdx = identicalSingleQueryIdxes[idx];
+        return singleQueries[idx]->isReadOnly() ? identicalIdx : idx;
+    }
+
 private:
     std::vector<std::unique_ptr<NormalizedSingleQuery>> singleQueries;
     std::vector<bool> isUnionAll;
+    std::vector<uint32_t> identicalSingleQueryIdxes;
 };
 
 } // namespace binder
@@ -73,6 +73,10 @@ struct StorageConstants {
     static constexpr uint64_t PAGE_GROUP_SIZE_LOG2 = 10;
     static constexpr uint64_t PAGE_GROUP_SIZE = (uint64_t)1 << PAGE_GROUP_SIZE_LOG2;
     static constexpr uint64_t PAGE_IDX_IN_GROUP_MASK = ((uint64_t)1 << PAGE_GROUP_SIZE_LOG2) - 1;
+
+    // The max number of consecutive pages that the WALReplayer copies from the WAL into a db file
+    // with a single write when checkpointing.
+    static constexpr uint64_t MAX_NUM_PAGES_PER_CHECKPOINT_WRITE = 64;
 };
 
 struct ListsMetadataConstants {
@@ -137,11 +141,31 @@ struct PlannerKnobs {
     // Avoid doing probe to build SIP if we have to accumulate a probe side that is much bigger than
     // build side. Also avoid doing build to probe SIP if probe side is not much bigger than build.
     static constexpr uint64_t ACC_HJ_PROBE_BUILD_RATIO = 5;
+    // Once join enumeration of a query graph has generated this many plans, remaining levels are
+    // planned by extending subgraphs with a single rel instead of considering all pairs of
+    // subgraphs. Counting plans instead of measuring time keeps the chosen plan deterministic.
+    static constexpr uint64_t MAX_NUM_PLANS_TO_ENUMERATE_EXACTLY = 10000;
 };
 
 struct ClientContextConstants {
     // We disable query timeout by default.
     static constexpr uint64_t TIMEOUT_IN_MS = 0;
+    // By default, a write transaction fails immediately if another write transaction is active.
+    static constexpr uint64_t WRITE_TRANSACTION_WAIT_TIMEOUT_IN_MS = 0;
+    // Max number of compiled plans kept in the database's plan cache. 0 disables the cache.
+    static constexpr uint64_t PLAN_CACHE_CAPACITY = 256;
+    // Cached plans are invalidated once the number of tuples of a table grows or shrinks by more
+    // than this factor since the last invalidation. Smaller changes keep cached plans valid.
+    static constexpr double PLAN_CACHE_STATISTICS_CHANGE_RATIO = 2.0;
+    // Number of leading bytes of a string ORDER BY key that are encoded into the sort key. Strings
+    // sharing a longer prefix are ordered by comparing the full strings.
+    static constexpr uint32_t ORDER_BY_STRING_KEY_PREFIX_LENGTH = 12;
+    // Upper bound of the prefix length above, which keeps sort keys small enough for many tuples to
+    // fit into a key block.
+    static constexpr uint32_t MAX_ORDER_BY_STRING_KEY_PREFIX_LENGTH = 255;
+    // Queries of all connections have the same priority by default, so none of them preempts
+    // another.
+    static constexpr uint64_t QUERY_PRIORITY = 0;
 };
 
 } // namespace common
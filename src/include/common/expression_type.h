@@ -18,6 +18,7 @@ const std::string AVG_FUNC_NAME = "AVG";
 const std::string MIN_FUNC_NAME = "MIN";
 const std::string MAX_FUNC_NAME = "MAX";
 const std::string COLLECT_FUNC_NAME = "COLLECT";
+const std::string APPROX_COUNT_DISTINCT_FUNC_NAME = "APPROX_COUNT_DISTINCT";
 
 // cast
 const std::string CAST_TO_DATE_FUNC_NAME = "DATE";
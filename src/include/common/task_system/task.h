@@ -1,7 +1,10 @@
 #pragma once
 
+#include <atomic>
+#include <condition_variable>
 #include <memory>
 #include <mutex>
+#include <thread>
 #include <vector>
 
 namespace kuzu {
@@ -20,6 +23,11 @@ using lock_t = std::unique_lock<std::mutex>;
  * calls and if there is some state from the run() function execution that will be needed by
  * finalizeIfNecessary, users should save it somewhere that can be accessed in
  * finalizeIfNecessary(). See ProcessorTask for an example of this.
+ *
+ * Tasks whose run() can stop between units of work, e.g., morsels, override canYield() and call
+ * yieldThreadIfRequested() between these units. If the TaskScheduler asked the task to yield a
+ * thread, the thread returns from run() early and is deregistered without finishing the task, so
+ * the task is neither completed nor finalized and its remaining work is picked up by other workers.
  */
 class Task {
 
@@ -58,17 +66,61 @@ public:
         return (numThreadsRegistered > 0 && numThreadsFinished == numThreadsRegistered);
     }
 
-    inline void setSingleThreadedTask() { maxNumThreads = 1; }
+    inline void setSingleThreadedTask() {
+        maxNumThreads = 1;
+        singleThreaded = true;
+    }
+
+    inline uint64_t getMaxNumThreads() const { return maxNumThreads; }
+
+    // Tasks with a higher priority get workers first and can make threads of lower priority tasks
+    // yield.
+    inline void setPriority(uint64_t priority_) { priority = priority_; }
+    inline uint64_t getPriority() const { return priority; }
+
+    // Whether run() calls yieldThreadIfRequested() between units of work.
+    virtual bool canYield() const { return false; }
+
+    // Asks one running thread of the task to yield. Returns false if the task cannot yield or all
+    // of its running threads are already asked to.
+    bool requestThreadToYield();
+
+    // Called by run() between units of work. Returns true if the calling thread should return
+    // from run() and leave the remaining work to other threads.
+    inline bool yieldThreadIfRequested() {
+        if (numThreadsToYield.load(std::memory_order_relaxed) == 0) {
+            return false;
+        }
+        return yieldThreadIfRequestedSlow();
+    }
+
+    inline bool canRegisterThread() {
+        lock_t lck{mtx};
+        return !hasExceptionNoLock() && canRegisterInternalNoLock();
+    }
+
+    inline uint64_t getNumThreadsRegistered() {
+        lock_t lck{mtx};
+        return numThreadsRegistered;
+    }
 
     bool registerThread();
 
+    // Deregisters the calling worker after run() returns. A worker that yielded is removed from
+    // the registered threads so that the task accepts workers again. Any other worker finishes the
+    // task and the last one finalizes it.
     void deRegisterThreadAndFinalizeTaskIfNecessary();
 
+    // Blocks until the task is completed, or until it has an exception if stopOnException is
+    // true. If maxWaitTimeInMicros is not 0, returns after at most maxWaitTimeInMicros.
+    void waitUntilCompleted(bool stopOnException, uint64_t maxWaitTimeInMicros = 0);
+
     inline void setException(std::exception_ptr exceptionPtr) {
         lock_t lck{mtx};
         if (this->exceptionsPtr == nullptr) {
             this->exceptionsPtr = exceptionPtr;
         }
+        completedOrErrored.notify_all();
     }
 
     inline bool hasException() {
@@ -88,6 +140,8 @@ private:
 
     inline bool hasExceptionNoLock() const { return exceptionsPtr != nullptr; }
 
+    bool yieldThreadIfRequestedSlow();
+
 public:
     Task* parent = nullptr;
     std::vector<std::shared_ptr<Task>>
@@ -95,9 +149,16 @@ public:
 
 protected:
     std::mutex mtx;
+    std::condition_variable completedOrErrored;
     uint64_t maxNumThreads, numThreadsFinished{0}, numThreadsRegistered{0};
     std::exception_ptr exceptionsPtr = nullptr;
     uint64_t ID;
+    bool singleThreaded = false;
+    uint64_t priority = 0;
+    // Number of running threads that are asked to yield at their next check.
+    std::atomic<uint64_t> numThreadsToYield{0};
+    // Threads that have yielded but have not returned from run() yet.
+    std::vector<std::thread::id> yieldedThreads;
 };
 
 } // namespace common
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <atomic>
+#include <condition_variable>
 #include <deque>
 #include <thread>
 
@@ -21,8 +22,8 @@ struct ScheduledTask {
  * TaskScheduler is a library that manages a set of worker threads that can execute tasks that are
  * put into a task queue. Each task accepts a maximum number of threads. Users of TaskScheduler
  * schedule tasks to be executed by calling schedule functions, e.g., scheduleTask or
- * scheduleTaskAndWaitOrError. New tasks are put at the end of the queue. Workers grab the first
- * task from the beginning of the queue that they can register themselves to work on. Any task that
+ * scheduleTaskAndWaitOrError. New tasks are put at the end of the queue. Workers grab a task from
+ * the queue that they can register themselves to work on (see below). Any task that
  * is completed is removed automatically from the queue. If there is a task that raises an
  * exception, the worker threads catch it and store it with the tasks. The user thread that is
  * waiting on the completion of the task (or tasks) will throw the exception (the user thread could
@@ -41,10 +42,28 @@ struct ScheduledTask {
  * one of the threads working on T that errored. This is simply done by the call:
  *      scheduleTaskAndWaitOrError(T);
  *
- * TaskScheduler guarantees that workers will register themselves to tasks in FIFO order. However
- * this does not guarantee that the tasks will be completed in FIFO order: a long running task
- * that is not accepting more registration can stay in the queue for an unlimited time until
- * completion.
+ * A task accepts workers only until one of its workers finishes. A free worker registers itself to
+ * the task with the highest priority that accepts workers. Among tasks of the same priority it
+ * picks the one with the fewest workers, breaking ties in FIFO order. So workers that become free
+ * while several tasks wait, e.g., from different connections, are spread over these tasks instead
+ * of all registering to the earliest one.
+ *
+ * Task priorities are set by the users of the scheduler, e.g., the processor uses the query
+ * priority of the connection. When a task is scheduled while all workers are busy, running tasks
+ * of lower priority are asked to yield as many threads as the new task can use. Only tasks that
+ * can stop between units of work yield (see Task::canYield()), e.g., processor tasks stop between
+ * morsels. A yielded thread leaves the rest of its task to other workers and then picks the new
+ * task. Tasks that cannot yield, and tasks of the same priority, are not preempted, so a task
+ * scheduled behind them waits until some worker finishes. This does not guarantee that the tasks
+ * will be completed in FIFO order: a long running task that is not accepting more registration can
+ * stay in the queue for an unlimited time until completion.
+ *
+ * There is no admission control: every scheduled task is queued and started once a worker picks
+ * it, regardless of how many tasks are already running. Limiting the number of concurrent queries
+ * is left to the users of the scheduler.
+ *
+ * Neither workers nor waiting users poll. Idle workers block until a task is scheduled, and a task
+ * is removed from the queue by the last worker finishing it, which then wakes up waiting users.
  */
 class TaskScheduler {
 public:
@@ -84,26 +103,41 @@ public:
     // Checks if there is an erroring task in the queue and if so, errors.
     void errorIfThereIsAnException();
 
-    bool isTaskQueueEmpty() { return taskQueue.empty(); }
-    uint64_t getNumTasks() { return taskQueue.size(); }
+    bool isTaskQueueEmpty() {
+        lock_t lck{mtx};
+        return taskQueue.empty();
+    }
+    uint64_t getNumTasks() {
+        lock_t lck{mtx};
+        return taskQueue.size();
+    }
 
 private:
-    void removeErroringTask(uint64_t scheduledTaskID);
+    void removeTask(uint64_t scheduledTaskID);
 
     void errorIfThereIsAnExceptionNoLock();
+    bool hasExceptionNoLock();
 
     // Functions to launch worker threads and for the worker threads to use to grab task from queue.
     void runWorkerThread();
-    std::shared_ptr<ScheduledTask> getTaskAndRegister();
+    std::shared_ptr<ScheduledTask> getTaskAndRegisterNoLock();
+    void requestThreadsToYieldNoLock(const std::shared_ptr<Task>& task);
+    void finishTask(const std::shared_ptr<ScheduledTask>& scheduledTask);
 
     void interruptTaskIfTimeOutNoLock(processor::ExecutionContext* context);
 
 private:
     std::shared_ptr<spdlog::logger> logger;
     std::mutex mtx;
+    // Notified when a task is scheduled or when the workers need to stop.
+    std::condition_variable taskScheduled;
+    // Notified when a task is removed from the queue or errors.
+    std::condition_variable taskFinished;
     std::deque<std::shared_ptr<ScheduledTask>> taskQueue;
     std::atomic<bool> stopThreads{false};
     std::vector<std::thread> threads;
+    // Number of workers blocked waiting for a task to register to.
+    uint64_t numIdleWorkers;
     uint64_t nextScheduledTaskID;
 };
 
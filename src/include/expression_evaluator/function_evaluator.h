@@ -25,6 +25,10 @@ protected:
     void resolveResultVector(
         const processor::ResultSet& resultSet, storage::MemoryManager* memoryManager) override;
 
+private:
+    bool canSelectConjunctively(const common::SelectionVector& selVector) const;
+    bool selectConjunctively(common::SelectionVector& selVector);
+
 private:
     std::shared_ptr<binder::Expression> expression;
     function::scalar_exec_func execFunc;
@@ -129,8 +129,14 @@ public:
         const common::DataType& inputType, bool isDistinct);
     static std::unique_ptr<AggregateFunction> getCollectFunction(
         const common::DataType& inputType, bool isDistinct);
+    static std::unique_ptr<AggregateFunction> getApproxCountDistinctFunction(
+        const common::DataType& inputType);
 
 private:
+    template<typename T>
+    static std::unique_ptr<AggregateFunction> getApproxCountDistinctFunction(
+        const common::DataType& inputType);
+
     template<typename FUNC>
     static std::unique_ptr<AggregateFunction> getMinMaxFunction(
         const common::DataType& inputType, bool isDistinct);
@@ -0,0 +1,105 @@
+#pragma once
+
+#include <cmath>
+
+#include "aggregate_function.h"
+#include "function/hash/hash_operations.h"
+
+namespace kuzu {
+namespace function {
+
+// Estimates the number of distinct non-null values with a HyperLogLog sketch. The sketch has a
+// fixed size and two sketches are merged by taking the register-wise maximum, so unlike COUNT
+// DISTINCT the function does not need a distinct hash table and can run in parallel.
+template<typename T>
+struct ApproxCountDistinctFunction {
+
+    // 2^12 registers give a standard error of 1.04 / sqrt(2^12) ~= 1.6%.
+    static constexpr uint64_t NUM_REGISTER_BITS = 12;
+    static constexpr uint64_t NUM_REGISTERS = (uint64_t)1 << NUM_REGISTER_BITS;
+
+    struct ApproxCountDistinctState : public AggregateState {
+        inline uint32_t getStateSize() const override { return sizeof(*this); }
+        inline void moveResultToVector(common::ValueVector* outputVector, uint64_t pos) override {
+            memcpy(outputVector->getData() + pos * outputVector->getNumBytesPerValue(),
+                reinterpret_cast<uint8_t*>(&count), outputVector->getNumBytesPerValue());
+        }
+
+        uint8_t registers[NUM_REGISTERS] = {0};
+        int64_t count = 0;
+    };
+
+    static std::unique_ptr<AggregateState> initialize() {
+        auto state = std::make_unique<ApproxCountDistinctState>();
+        state->isNull = false;
+        return state;
+    }
+
+    static void updateAll(uint8_t* state_, common::ValueVector* input, uint64_t multiplicity,
+        storage::MemoryManager* memoryManager) {
+        auto state = reinterpret_cast<ApproxCountDistinctState*>(state_);
+        auto& selVector = input->state->selVector;
+        if (input->hasNoNullsGuarantee()) {
+            for (auto i = 0u; i < selVector->selectedSize; ++i) {
+                updateSingleValue(state, input, selVector->selectedPositions[i]);
+            }
+        } else {
+            for (auto i = 0u; i < selVector->selectedSize; ++i) {
+                auto pos = selVector->selectedPositions[i];
+                if (!input->isNull(pos)) {
+                    updateSingleValue(state, input, pos);
+                }
+            }
+        }
+    }
+
+    // Multiplicity is ignored because duplicates do not change the number of distinct values.
+    static inline void updatePos(uint8_t* state_, common::ValueVector* input, uint64_t multiplicity,
+        uint32_t pos, storage::MemoryManager* memoryManager) {
+        updateSingleValue(reinterpret_cast<ApproxCountDistinctState*>(state_), input, pos);
+    }
+
+    static inline void updateSingleValue(
+        ApproxCountDistinctState* state, common::ValueVector* input, uint32_t pos) {
+        common::hash_t hash;
+        operation::Hash::operation(input->getValue<T>(pos), hash);
+        // The leading bits of the hash pick the register. The register keeps the maximum rank,
+        // i.e., the position of the leftmost 1-bit, among the remaining bits. The lowest bit is
+        // set so that the rank is bounded even if all remaining bits are 0.
+        auto registerIdx = hash >> (64 - NUM_REGISTER_BITS);
+        auto remainingBits = (hash << NUM_REGISTER_BITS) | ((uint64_t)1 << (NUM_REGISTER_BITS - 1));
+        auto rank = (uint8_t)(__builtin_clzll(remainingBits) + 1);
+        state->registers[registerIdx] = std::max(state->registers[registerIdx], rank);
+    }
+
+    static void combine(
+        uint8_t* state_, uint8_t* otherState_, storage::MemoryManager* memoryManager) {
+        auto state = reinterpret_cast<ApproxCountDistinctState*>(state_);
+        auto otherState = reinterpret_cast<ApproxCountDistinctState*>(otherState_);
+        for (auto i = 0u; i < NUM_REGISTERS; ++i) {
+            state->registers[i] = std::max(state->registers[i], otherState->registers[i]);
+        }
+    }
+
+    static void finalize(uint8_t* state_) {
+        auto state = reinterpret_cast<ApproxCountDistinctState*>(state_);
+        auto numZeroRegisters = 0u;
+        double sum = 0;
+        for (auto i = 0u; i < NUM_REGISTERS; ++i) {
+            numZeroRegisters += state->registers[i] == 0;
+            sum += std::ldexp(1.0, -state->registers[i]);
+        }
+        auto numRegisters = (double)NUM_REGISTERS;
+        auto alpha = 0.7213 / (1 + 1.079 / numRegisters);
+        auto estimate = alpha * numRegisters * numRegisters / sum;
+        // The raw estimate is biased for small cardinalities, for which linear counting on the
+        // number of empty registers is more accurate.
+        if (estimate <= 2.5 * numRegisters && numZeroRegisters != 0) {
+            estimate = numRegisters * std::log(numRegisters / numZeroRegisters);
+        }
+        state->count = (int64_t)std::llround(estimate);
+    }
+};
+
+} // namespace function
+} // namespace kuzu
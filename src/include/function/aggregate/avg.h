@@ -49,14 +49,16 @@ struct AvgFunction {
 
     static void updateSingleValue(
         AvgState* state, common::ValueVector* input, uint32_t pos, uint64_t multiplicity) {
+        // A value with multiplicity m is added once as value * m instead of m times.
         T val = input->getValue<T>(pos);
-        for (auto i = 0u; i < multiplicity; ++i) {
-            if (state->isNull) {
-                state->sum = val;
-                state->isNull = false;
-            } else {
-                operation::Add::operation(state->sum, val, state->sum);
-            }
+        if (multiplicity != 1) {
+            val *= multiplicity;
+        }
+        if (state->isNull) {
+            state->sum = val;
+            state->isNull = false;
+        } else {
+            operation::Add::operation(state->sum, val, state->sum);
         }
         state->count += multiplicity;
     }
@@ -35,6 +35,7 @@ private:
     void registerMin();
     void registerMax();
     void registerCollect();
+    void registerApproxCountDistinct();
 
 private:
     std::unordered_map<std::string, std::vector<std::unique_ptr<AggregateFunctionDefinition>>>
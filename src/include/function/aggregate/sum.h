@@ -48,14 +48,16 @@ struct SumFunction {
 
     static void updateSingleValue(
         SumState* state, common::ValueVector* input, uint32_t pos, uint64_t multiplicity) {
+        // A value with multiplicity m is added once as value * m instead of m times.
         T val = input->getValue<T>(pos);
-        for (auto j = 0u; j < multiplicity; ++j) {
-            if (state->isNull) {
-                state->sum = val;
-                state->isNull = false;
-            } else {
-                operation::Add::operation(state->sum, val, state->sum);
-            }
+        if (multiplicity != 1) {
+            val *= multiplicity;
+        }
+        if (state->isNull) {
+            state->sum = val;
+            state->isNull = false;
+        } else {
+            operation::Add::operation(state->sum, val, state->sum);
         }
     }
 
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <functional>
+#include <type_traits>
 
 #include "common/type_utils.h"
 #include "common/vector/value_vector.h"
@@ -49,6 +50,26 @@ struct BinaryOperationExecutor {
             (void*)&resultValueVector);
     }
 
+    // Dense paths are taken when the unflat inputs are unfiltered and have no nulls. Value pointers
+    // are hoisted out of the loop and the loop body is branch free, so that the compiler is able to
+    // auto-vectorize it (executeOnValue reloads the data pointers after each store to a uint8_t
+    // result, which prevents vectorization of comparisons). Flat inputs are read from position 0
+    // of the given pointer.
+    template<typename OP_WRAPPER>
+    static constexpr bool hasDensePath() {
+        return std::is_same_v<OP_WRAPPER, BinaryOperationWrapper>;
+    }
+
+    template<typename LEFT_TYPE, typename RIGHT_TYPE, typename RESULT_TYPE, typename FUNC,
+        bool IS_LEFT_FLAT, bool IS_RIGHT_FLAT>
+    static void executeDense(LEFT_TYPE* leftValues, RIGHT_TYPE* rightValues,
+        RESULT_TYPE* resultValues, uint64_t numValues) {
+        for (auto i = 0u; i < numValues; ++i) {
+            FUNC::operation(leftValues[IS_LEFT_FLAT ? 0 : i], rightValues[IS_RIGHT_FLAT ? 0 : i],
+                resultValues[i]);
+        }
+    }
+
     template<typename LEFT_TYPE, typename RIGHT_TYPE, typename RESULT_TYPE, typename FUNC,
         typename OP_WRAPPER>
     static void executeBothFlat(
@@ -72,6 +93,12 @@ struct BinaryOperationExecutor {
             result.setAllNull();
         } else if (right.hasNoNullsGuarantee()) {
             if (right.state->selVector->isUnfiltered()) {
+                if constexpr (hasDensePath<OP_WRAPPER>()) {
+                    executeDense<LEFT_TYPE, RIGHT_TYPE, RESULT_TYPE, FUNC, true, false>(
+                        (LEFT_TYPE*)left.getData() + lPos, (RIGHT_TYPE*)right.getData(),
+                        (RESULT_TYPE*)result.getData(), right.state->selVector->selectedSize);
+                    return;
+                }
                 for (auto i = 0u; i < right.state->selVector->selectedSize; ++i) {
                     executeOnValue<LEFT_TYPE, RIGHT_TYPE, RESULT_TYPE, FUNC, OP_WRAPPER>(
                         left, right, result, lPos, i, i);
@@ -114,6 +141,12 @@ struct BinaryOperationExecutor {
             result.setAllNull();
         } else if (left.hasNoNullsGuarantee()) {
             if (left.state->selVector->isUnfiltered()) {
+                if constexpr (hasDensePath<OP_WRAPPER>()) {
+                    executeDense<LEFT_TYPE, RIGHT_TYPE, RESULT_TYPE, FUNC, false, true>(
+                        (LEFT_TYPE*)left.getData(), (RIGHT_TYPE*)right.getData() + rPos,
+                        (RESULT_TYPE*)result.getData(), left.state->selVector->selectedSize);
+                    return;
+                }
                 for (auto i = 0u; i < left.state->selVector->selectedSize; ++i) {
                     executeOnValue<LEFT_TYPE, RIGHT_TYPE, RESULT_TYPE, FUNC, OP_WRAPPER>(
                         left, right, result, i, rPos, i);
@@ -154,6 +187,12 @@ struct BinaryOperationExecutor {
         assert(left.state == right.state);
         if (left.hasNoNullsGuarantee() && right.hasNoNullsGuarantee()) {
             if (result.state->selVector->isUnfiltered()) {
+                if constexpr (hasDensePath<OP_WRAPPER>()) {
+                    executeDense<LEFT_TYPE, RIGHT_TYPE, RESULT_TYPE, FUNC, false, false>(
+                        (LEFT_TYPE*)left.getData(), (RIGHT_TYPE*)right.getData(),
+                        (RESULT_TYPE*)result.getData(), result.state->selVector->selectedSize);
+                    return;
+                }
                 for (uint64_t i = 0; i < result.state->selVector->selectedSize; i++) {
                     executeOnValue<LEFT_TYPE, RIGHT_TYPE, RESULT_TYPE, FUNC, OP_WRAPPER>(
                         left, right, result, i, i, i);
@@ -241,6 +280,22 @@ struct BinaryOperationExecutor {
         numSelectedValues += (resultValue == true);
     }
 
+    // Dense select first evaluates the comparison into a byte mask, which can be vectorized, and
+    // then compacts the mask into selected positions without branches.
+    template<class LEFT_TYPE, class RIGHT_TYPE, class FUNC, bool IS_LEFT_FLAT, bool IS_RIGHT_FLAT>
+    static uint64_t selectDense(LEFT_TYPE* leftValues, RIGHT_TYPE* rightValues, uint64_t numValues,
+        common::sel_t* selectedPositionsBuffer) {
+        uint8_t mask[common::DEFAULT_VECTOR_CAPACITY];
+        executeDense<LEFT_TYPE, RIGHT_TYPE, uint8_t, FUNC, IS_LEFT_FLAT, IS_RIGHT_FLAT>(
+            leftValues, rightValues, mask, numValues);
+        uint64_t numSelectedValues = 0;
+        for (auto i = 0u; i < numValues; ++i) {
+            selectedPositionsBuffer[numSelectedValues] = i;
+            numSelectedValues += mask[i];
+        }
+        return numSelectedValues;
+    }
+
     template<class LEFT_TYPE, class RIGHT_TYPE, class FUNC>
     static uint64_t selectBothFlat(common::ValueVector& left, common::ValueVector& right) {
         auto lPos = left.state->selVector->selectedPositions[0];
@@ -263,10 +318,9 @@ struct BinaryOperationExecutor {
             return numSelectedValues;
         } else if (right.hasNoNullsGuarantee()) {
             if (right.state->selVector->isUnfiltered()) {
-                for (auto i = 0u; i < right.state->selVector->selectedSize; ++i) {
-                    selectOnValue<LEFT_TYPE, RIGHT_TYPE, FUNC>(
-                        left, right, lPos, i, i, numSelectedValues, selectedPositionsBuffer);
-                }
+                numSelectedValues = selectDense<LEFT_TYPE, RIGHT_TYPE, FUNC, true, false>(
+                    (LEFT_TYPE*)left.getData() + lPos, (RIGHT_TYPE*)right.getData(),
+                    right.state->selVector->selectedSize, selectedPositionsBuffer);
             } else {
                 for (auto i = 0u; i < right.state->selVector->selectedSize; ++i) {
                     auto rPos = right.state->selVector->selectedPositions[i];
@@ -306,10 +360,9 @@ struct BinaryOperationExecutor {
             return numSelectedValues;
         } else if (left.hasNoNullsGuarantee()) {
             if (left.state->selVector->isUnfiltered()) {
-                for (auto i = 0u; i < left.state->selVector->selectedSize; ++i) {
-                    selectOnValue<LEFT_TYPE, RIGHT_TYPE, FUNC>(
-                        left, right, i, rPos, i, numSelectedValues, selectedPositionsBuffer);
-                }
+                numSelectedValues = selectDense<LEFT_TYPE, RIGHT_TYPE, FUNC, false, true>(
+                    (LEFT_TYPE*)left.getData(), (RIGHT_TYPE*)right.getData() + rPos,
+                    left.state->selVector->selectedSize, selectedPositionsBuffer);
             } else {
                 for (auto i = 0u; i < left.state->selVector->selectedSize; ++i) {
                     auto lPos = left.state->selVector->selectedPositions[i];
@@ -347,10 +400,9 @@ struct BinaryOperationExecutor {
         auto selectedPositionsBuffer = selVector.getSelectedPositionsBuffer();
         if (left.hasNoNullsGuarantee() && right.hasNoNullsGuarantee()) {
             if (left.state->selVector->isUnfiltered()) {
-                for (auto i = 0u; i < left.state->selVector->selectedSize; i++) {
-                    selectOnValue<LEFT_TYPE, RIGHT_TYPE, FUNC>(
-                        left, right, i, i, i, numSelectedValues, selectedPositionsBuffer);
-                }
+                numSelectedValues = selectDense<LEFT_TYPE, RIGHT_TYPE, FUNC, false, false>(
+                    (LEFT_TYPE*)left.getData(), (RIGHT_TYPE*)right.getData(),
+                    left.state->selVector->selectedSize, selectedPositionsBuffer);
             } else {
                 for (auto i = 0u; i < left.state->selVector->selectedSize; i++) {
                     auto pos = left.state->selVector->selectedPositions[i];
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <cstdint>
+#include <cstring>
 #include <unordered_set>
 
 #include "common/type_utils.h"
@@ -12,14 +13,41 @@ namespace operation {
 
 constexpr const uint64_t NULL_HASH = UINT64_MAX;
 
+// Finalizer of murmur3. Every input bit affects every output bit, so hash tables that take the
+// lower bits of the hash as slot index do not cluster on sequential or strided keys. The function
+// has no branches and compiles to shifts and multiplies, which vectorize in hash loops.
 inline common::hash_t murmurhash64(uint64_t x) {
-    return x * UINT64_C(0xbf58476d1ce4e5b9);
+    x ^= x >> 33;
+    x *= UINT64_C(0xff51afd7ed558ccd);
+    x ^= x >> 33;
+    x *= UINT64_C(0xc4ceb9fe1a85ec53);
+    x ^= x >> 33;
+    return x;
 }
 
 inline common::hash_t combineHashScalar(common::hash_t a, common::hash_t b) {
     return (a * UINT64_C(0xbf58476d1ce4e5b9)) ^ b;
 }
 
+// Hashes the bytes 8 at a time without allocating. The length is mixed in so that strings that
+// differ only in trailing zero bytes do not collide.
+inline common::hash_t hashBytes(const uint8_t* data, uint64_t len) {
+    auto result = murmurhash64(len);
+    auto numFullWords = len / sizeof(uint64_t);
+    for (auto i = 0u; i < numFullWords; ++i) {
+        uint64_t word;
+        memcpy(&word, data + i * sizeof(uint64_t), sizeof(uint64_t));
+        result = combineHashScalar(result, murmurhash64(word));
+    }
+    auto numRemainingBytes = len - numFullWords * sizeof(uint64_t);
+    if (numRemainingBytes > 0) {
+        uint64_t word = 0;
+        memcpy(&word, data + numFullWords * sizeof(uint64_t), numRemainingBytes);
+        result = combineHashScalar(result, murmurhash64(word));
+    }
+    return result;
+}
+
 struct Hash {
     template<class T>
     static inline void operation(const T& key, common::hash_t& result) {
@@ -46,7 +74,7 @@ struct CombineHash {
 
 template<>
 inline void Hash::operation(const common::internalID_t& key, common::hash_t& result) {
-    result = murmurhash64(key.offset) ^ murmurhash64(key.tableID);
+    result = combineHashScalar(murmurhash64(key.tableID), murmurhash64(key.offset));
 }
 
 template<>
@@ -79,24 +107,34 @@ inline void Hash::operation(const int16_t& key, common::hash_t& result) {
     result = murmurhash64(key);
 }
 
+// Floating point values are hashed on their bit representation rather than on their truncated
+// integer value. 0.0 and -0.0 compare equal, so they are hashed the same.
 template<>
 inline void Hash::operation(const double_t& key, common::hash_t& result) {
-    result = murmurhash64(key);
+    uint64_t bits = 0;
+    if (key != 0) {
+        memcpy(&bits, &key, sizeof(key));
+    }
+    result = murmurhash64(bits);
 }
 
 template<>
 inline void Hash::operation(const float_t& key, common::hash_t& result) {
-    result = murmurhash64(key);
+    uint32_t bits = 0;
+    if (key != 0) {
+        memcpy(&bits, &key, sizeof(key));
+    }
+    result = murmurhash64(bits);
 }
 
 template<>
 inline void Hash::operation(const std::string& key, common::hash_t& result) {
-    result = std::hash<std::string>()(key);
+    result = hashBytes(reinterpret_cast<const uint8_t*>(key.data()), key.size());
 }
 
 template<>
 inline void Hash::operation(const common::ku_string_t& key, common::hash_t& result) {
-    result = std::hash<std::string>()(key.getAsString());
+    result = hashBytes(key.getData(), key.len);
 }
 
 template<>
@@ -124,7 +162,9 @@ inline void Hash::operation(const common::ku_list_t& key, common::hash_t& result
 template<>
 inline void Hash::operation(const std::unordered_set<std::string>& key, common::hash_t& result) {
     for (auto&& s : key) {
-        result ^= std::hash<std::string>()(s);
+        common::hash_t hash;
+        operation(s, hash);
+        result ^= hash;
     }
 }
 
@@ -20,9 +20,12 @@ struct UnaryHashOperationExecutor {
         } else {
             if (operand.hasNoNullsGuarantee()) {
                 if (operand.state->selVector->isUnfiltered()) {
-                    for (auto i = 0u; i < operand.state->selVector->selectedSize; i++) {
-                        operation::Hash::operation(
-                            operand.getValue<OPERAND_TYPE>(i), resultValues[i]);
+                    // Dense loop over raw arrays so that the compiler can vectorize the hash
+                    // function of fixed-sized types.
+                    auto operandValues = (OPERAND_TYPE*)operand.getData();
+                    auto numValues = operand.state->selVector->selectedSize;
+                    for (auto i = 0u; i < numValues; i++) {
+                        operation::Hash::operation(operandValues[i], resultValues[i]);
                     }
                 } else {
                     for (auto i = 0u; i < operand.state->selVector->selectedSize; i++) {
@@ -1,9 +1,9 @@
 #pragma once
 
-#include <regex>
+#include <cstring>
+#include <memory>
 
 #include "common/types/ku_string.h"
-#include "function/string/operations/find_operation.h"
 #include "re2.h"
 
 namespace kuzu {
@@ -13,11 +13,37 @@ namespace operation {
 struct REMatch {
     static inline void operation(
         common::ku_string_t& left, common::ku_string_t& right, uint8_t& result) {
-        // Cypher parses escape characters with 2 backslash eg. for expressing '.' requires '\\.'
-        // Since Regular Expression requires only 1 backslash '\.' we need to replace double slash
-        // with single
-        std::string pattern = std::regex_replace(right.getAsString(), std::regex(R"(\\\\)"), "\\");
-        result = RE2::FullMatch(left.getAsString(), pattern);
+        auto& re = getCompiledPattern(right);
+        result = RE2::FullMatch(regex::StringPiece((const char*)left.getData(), left.len), re);
+    }
+
+private:
+    // Patterns are usually constant within a query, so each thread keeps the last compiled pattern
+    // and only recompiles when the pattern changes.
+    static inline RE2& getCompiledPattern(common::ku_string_t& pattern) {
+        thread_local std::string lastPattern;
+        thread_local std::unique_ptr<RE2> lastCompiledPattern;
+        if (lastCompiledPattern == nullptr || lastPattern.size() != pattern.len ||
+            memcmp(lastPattern.data(), pattern.getData(), pattern.len) != 0) {
+            lastPattern.assign((const char*)pattern.getData(), pattern.len);
+            lastCompiledPattern = std::make_unique<RE2>(unescapePattern(lastPattern));
+        }
+        return *lastCompiledPattern;
+    }
+
+    // Cypher parses escape characters with 2 backslash eg. for expressing '.' requires '\\.'
+    // Since Regular Expression requires only 1 backslash '\.' we need to replace double slash
+    // with single
+    static inline std::string unescapePattern(const std::string& pattern) {
+        std::string result;
+        result.reserve(pattern.size());
+        for (auto i = 0u; i < pattern.size(); ++i) {
+            result += pattern[i];
+            if (pattern[i] == '\\' && i + 1 < pattern.size() && pattern[i + 1] == '\\') {
+                i++;
+            }
+        }
+        return result;
     }
 };
 
@@ -1,5 +1,7 @@
 #pragma once
 
+#include <cstring>
+
 #include "common/types/ku_string.h"
 
 namespace kuzu {
@@ -9,9 +11,18 @@ namespace operation {
 struct StartsWith {
     static inline void operation(
         common::ku_string_t& left, common::ku_string_t& right, uint8_t& result) {
-        auto lStr = left.getAsString();
-        auto rStr = right.getAsString();
-        result = lStr.starts_with(rStr);
+        if (right.len > left.len) {
+            result = false;
+            return;
+        }
+        // The first PREFIX_LENGTH bytes of both strings are inlined, so most mismatches are found
+        // without dereferencing the overflow pointers.
+        auto prefixLen = std::min<uint32_t>(right.len, common::ku_string_t::PREFIX_LENGTH);
+        if (memcmp(left.prefix, right.prefix, prefixLen) != 0) {
+            result = false;
+            return;
+        }
+        result = memcmp(left.getData(), right.getData(), right.len) == 0;
     }
 };
 
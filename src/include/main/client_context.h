@@ -42,10 +42,19 @@ public:
 
     void startTimingIfEnabled();
 
+    inline uint32_t getOrderByStringKeyPrefixLength() const {
+        return orderByStringKeyPrefixLength;
+    }
+
+    inline uint64_t getQueryPriority() const { return queryPriority; }
+
 private:
     uint64_t numThreadsForExecution;
     std::unique_ptr<ActiveQuery> activeQuery;
     uint64_t timeoutInMS;
+    uint64_t writeTransactionWaitTimeoutInMS;
+    uint32_t orderByStringKeyPrefixLength;
+    uint64_t queryPriority;
 };
 
 } // namespace main
@@ -138,6 +138,27 @@ public:
      */
     KUZU_API void setQueryTimeOut(uint64_t timeoutInMS);
 
+    /**
+     * @brief sets how long a write transaction of the current connection waits for the active write
+     * transaction of another connection to finish before failing. A value of zero (the default)
+     * fails immediately.
+     */
+    KUZU_API void setWriteTransactionWaitTimeOut(uint64_t timeoutInMS);
+
+    /**
+     * @brief sets how many leading bytes of a string ORDER BY key are encoded into the sort key
+     * (12 by default). A longer prefix makes sorting strings that share long prefixes cheaper at
+     * the cost of wider sort keys.
+     */
+    KUZU_API void setOrderByStringKeyPrefixLength(uint32_t prefixLength);
+
+    /**
+     * @brief sets the priority of the queries of the current connection (0 by default). Free
+     * threads work on queries of higher priority first, and a query of higher priority makes
+     * threads of lower priority queries switch to it between morsels.
+     */
+    KUZU_API void setQueryPriority(uint64_t priority);
+
 protected:
     ConnectionTransactionMode getTransactionMode();
     void setTransactionModeNoLock(ConnectionTransactionMode newTransactionMode);
@@ -2,9 +2,11 @@
 
 #include <memory>
 #include <thread>
+#include <unordered_map>
 
 #include "common/api.h"
 #include "common/constants.h"
+#include "common/types/internal_id_t.h"
 #include "kuzu_fwd.h"
 
 namespace kuzu {
@@ -61,6 +63,15 @@ public:
      */
     static void setLoggingLevel(std::string loggingLevel);
 
+    /**
+     * @return the number of queries whose plan was found in the plan cache.
+     */
+    KUZU_API uint64_t getNumPlanCacheHits() const;
+    /**
+     * @return the number of queries whose plan was not found in the plan cache.
+     */
+    KUZU_API uint64_t getNumPlanCacheMisses() const;
+
 private:
     // Commits and checkpoints a write transaction or rolls that transaction back. This involves
     // either replaying the WAL and either redoing or undoing and in either case at the end WAL is
@@ -78,6 +89,12 @@ private:
     void recoverIfNecessary();
     void checkpointOrRollbackAndClearWAL(bool isRecovering, bool isCheckpoint);
 
+    std::unordered_map<common::table_id_t, uint64_t> getNumTuplesPerTable() const;
+    // Returns whether the number of tuples of any table changed by more than
+    // PLAN_CACHE_STATISTICS_CHANGE_RATIO since cached plans were last invalidated.
+    bool haveStatisticsChangedForPlanCache(
+        const std::unordered_map<common::table_id_t, uint64_t>& numTuplesPerTable) const;
+
 private:
     std::string databasePath;
     SystemConfig systemConfig;
@@ -88,6 +105,9 @@ private:
     std::unique_ptr<storage::StorageManager> storageManager;
     std::unique_ptr<transaction::TransactionManager> transactionManager;
     std::unique_ptr<storage::WAL> wal;
+    std::unique_ptr<PlanCache> planCache;
+    // Number of tuples per table when cached plans were last invalidated.
+    std::unordered_map<common::table_id_t, uint64_t> numTuplesPerTableForPlanCache;
     std::shared_ptr<spdlog::logger> logger;
 };
 
@@ -40,6 +40,10 @@ namespace planner {
 class LogicalPlan;
 } // namespace planner
 
+namespace main {
+class PlanCache;
+} // namespace main
+
 namespace processor {
 class QueryProcessor;
 class FactorizedTable;
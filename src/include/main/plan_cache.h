@@ -0,0 +1,81 @@
+#pragma once
+
+#include <list>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+#include "binder/bound_statement_result.h"
+#include "common/statement_type.h"
+#include "common/types/value.h"
+#include "planner/logical_plan/logical_plan.h"
+
+namespace kuzu {
+namespace main {
+
+// Compiled form of a query. Physical plans are still mapped per execution from a shallow copy of
+// logicalPlan, so a cached plan can be shared by concurrent connections. parameterMap holds the
+// parameters of the query with their bound data types. Each prepared statement gets its own copy
+// of these values and the plan mapper reads parameters from that copy.
+struct CachedPlan {
+    common::StatementType statementType;
+    bool readOnly;
+    bool isExplain;
+    bool isProfile;
+    std::unordered_map<std::string, std::shared_ptr<common::Value>> parameterMap;
+    std::unique_ptr<binder::BoundStatementResult> statementResult;
+    std::unique_ptr<planner::LogicalPlan> logicalPlan;
+};
+
+// LRU cache of compiled plans keyed on normalized query text. Cached plans depend on the catalog
+// and table statistics. The database invalidates the cache when a committed write transaction
+// changes the catalog or changes the number of tuples of a table by more than
+// PLAN_CACHE_STATISTICS_CHANGE_RATIO. Each invalidation bumps the version so that a plan compiled
+// against the old state cannot be inserted after the invalidation.
+class PlanCache {
+public:
+    explicit PlanCache(uint64_t capacity)
+        : capacity{capacity}, version{0}, numHits{0}, numMisses{0} {}
+
+    static std::string normalizeQuery(const std::string& query);
+
+    inline uint64_t getVersion() {
+        std::lock_guard<std::mutex> lck{mtx};
+        return version;
+    }
+
+    // Returns nullptr on a miss.
+    std::shared_ptr<CachedPlan> get(const std::string& normalizedQuery);
+    // Inserts the plan only if the cache has not been invalidated since versionAtCompile.
+    void put(const std::string& normalizedQuery, std::shared_ptr<CachedPlan> plan,
+        uint64_t versionAtCompile);
+    void invalidate();
+
+    inline uint64_t getNumHits() {
+        std::lock_guard<std::mutex> lck{mtx};
+        return numHits;
+    }
+    inline uint64_t getNumMisses() {
+        std::lock_guard<std::mutex> lck{mtx};
+        return numMisses;
+    }
+    inline uint64_t getNumCachedPlans() {
+        std::lock_guard<std::mutex> lck{mtx};
+        return plans.size();
+    }
+
+private:
+    using plan_list_t = std::list<std::pair<std::string, std::shared_ptr<CachedPlan>>>;
+
+    std::mutex mtx;
+    uint64_t capacity;
+    uint64_t version;
+    uint64_t numHits;
+    uint64_t numMisses;
+    // Most recently used plan is at the front.
+    plan_list_t plans;
+    std::unordered_map<std::string, plan_list_t::iterator> queryToPlan;
+};
+
+} // namespace main
+} // namespace kuzu
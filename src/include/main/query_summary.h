@@ -13,6 +13,11 @@ namespace main {
  */
 struct PreparedSummary {
     double compilingTime = 0;
+    // Breakdown of compiling time. These are 0 if the plan was found in the plan cache.
+    double parsingTime = 0;
+    double bindingTime = 0;
+    // Includes both join order enumeration and optimization.
+    double planningTime = 0;
     bool isExplain = false;
     bool isProfile = false;
 };
@@ -23,12 +28,25 @@ struct PreparedSummary {
 class QuerySummary {
     friend class Connection;
     friend class benchmark::Benchmark;
+    friend class testing::ApiTest;
 
 public:
     /**
      * @return query compiling time.
      */
     KUZU_API double getCompilingTime() const;
+    /**
+     * @return time spent on parsing the query.
+     */
+    KUZU_API double getParsingTime() const;
+    /**
+     * @return time spent on binding the query.
+     */
+    KUZU_API double getBindingTime() const;
+    /**
+     * @return time spent on planning and optimizing the query.
+     */
+    KUZU_API double getPlanningTime() const;
     /**
      * @return query execution time.
      */
@@ -0,0 +1,25 @@
+#pragma once
+
+#include "logical_operator_visitor.h"
+#include "planner/logical_plan/logical_plan.h"
+
+namespace kuzu {
+namespace optimizer {
+
+// When the neighbours produced by an extend are discarded by the projection above it, only the
+// number of neighbours of each bound node contributes to the result, e.g.
+// MATCH (a)-[:knows]->(b) RETURN a.name, COUNT(*)
+// The number of neighbours is stored in the adjacency list headers, so this optimizer marks such
+// extends to read the list sizes instead of scanning the adjacency list pages.
+class DegreeOptimizer : public LogicalOperatorVisitor {
+public:
+    void rewrite(planner::LogicalPlan* plan);
+
+private:
+    void visitOperator(planner::LogicalOperator* op);
+
+    void visitProjection(planner::LogicalOperator* op) override;
+};
+
+} // namespace optimizer
+} // namespace kuzu
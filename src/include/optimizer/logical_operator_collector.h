@@ -31,6 +31,11 @@ protected:
     void visitScanNode(planner::LogicalOperator* op) override { ops.push_back(op); }
 };
 
+class LogicalExtendCollector : public LogicalOperatorCollector {
+protected:
+    void visitExtend(planner::LogicalOperator* op) override { ops.push_back(op); }
+};
+
 class LogicalIndexScanNodeCollector : public LogicalOperatorCollector {
 protected:
     void visitIndexScanNode(planner::LogicalOperator* op) override { ops.push_back(op); }
@@ -12,11 +12,16 @@ public:
     explicit RegularQuery(std::unique_ptr<SingleQuery> singleQuery)
         : Statement{common::StatementType::QUERY} {
         singleQueries.push_back(std::move(singleQuery));
+        identicalSingleQueryIdxes.push_back(0);
     }
 
-    inline void addSingleQuery(std::unique_ptr<SingleQuery> singleQuery, bool isUnionAllQuery) {
+    // identicalSingleQueryIdx is the index of the first single query whose text is identical to
+    // singleQuery, or the index of singleQuery itself if there is no such query.
+    inline void addSingleQuery(std::unique_ptr<SingleQuery> singleQuery, bool isUnionAllQuery,
+        uint32_t identicalSingleQueryIdx) {
         singleQueries.push_back(std::move(singleQuery));
         isUnionAll.push_back(isUnionAllQuery);
+        identicalSingleQueryIdxes.push_back(identicalSingleQueryIdx);
     }
 
     inline uint64_t getNumSingleQueries() const { return singleQueries.size(); }
@@ -27,9 +32,14 @@ public:
 
     inline std::vector<bool> getIsUnionAll() const { return isUnionAll; }
 
+    inline std::vector<uint32_t> getIdenticalSingleQueryIdxes() const {
+        return identicalSingleQueryIdxes;
+    }
+
 private:
     std::vector<std::unique_ptr<SingleQuery>> singleQueries;
     std::vector<bool> isUnionAll;
+    std::vector<uint32_t> identicalSingleQueryIdxes;
 };
 
 } // namespace parser
@@ -1,4 +1,5 @@
 #include "binder/query/reading_clause/query_graph.h"
+#include "catalog/catalog.h"
 #include "planner/logical_plan/logical_plan.h"
 #include "storage/store/nodes_statistics_and_deleted_ids.h"
 #include "storage/store/rels_statistics.h"
@@ -8,9 +9,10 @@ namespace planner {
 
 class CardinalityEstimator {
 public:
-    CardinalityEstimator(const storage::NodesStatisticsAndDeletedIDs& nodesStatistics,
+    CardinalityEstimator(const catalog::Catalog& catalog,
+        const storage::NodesStatisticsAndDeletedIDs& nodesStatistics,
         const storage::RelsStatistics& relsStatistics)
-        : nodesStatistics{nodesStatistics}, relsStatistics{relsStatistics} {}
+        : catalog{catalog}, nodesStatistics{nodesStatistics}, relsStatistics{relsStatistics} {}
 
     void initNodeIDDom(binder::QueryGraph* queryGraph);
 
@@ -22,22 +24,33 @@ public:
         const LogicalPlan& probePlan, const std::vector<std::unique_ptr<LogicalPlan>>& buildPlans);
     uint64_t estimateFlatten(const LogicalPlan& childPlan, f_group_pos groupPosToFlatten);
     uint64_t estimateFilter(const LogicalPlan& childPlan, const binder::Expression& predicate);
+    double getPredicateSelectivity(const binder::Expression& predicate);
 
     double getExtensionRate(
         const binder::RelExpression& rel, const binder::NodeExpression& boundNode);
 
 private:
-    inline uint64_t atLeastOne(uint64_t x) { return x == 0 ? 1 : x; }
+    // Estimates are computed in double. Clamp them to [1, UINT64_MAX] before converting so that
+    // products over large tables do not overflow.
+    inline uint64_t atLeastOne(double x) {
+        return x >= (double)UINT64_MAX ? UINT64_MAX : x < 1 ? 1 : (uint64_t)x;
+    }
 
     uint64_t getNodeIDDom(const std::string& nodeIDName) {
         assert(nodeIDName2dom.contains(nodeIDName));
         return nodeIDName2dom.at(nodeIDName);
     }
     uint64_t getNumNodes(const binder::NodeExpression& node);
-
-    uint64_t getNumRels(const binder::RelExpression& rel);
+    // Selectivity of an equality predicate on a primary key, i.e. 1 / number of nodes of the key's
+    // table. Falls back to the default equality selectivity if the key's node is not planned yet.
+    double getPrimaryKeySelectivity(const binder::PropertyExpression& property);
+    // Number of rels reachable from boundNode. Rel tables not connected to boundNode are skipped
+    // and single multiplicity rel tables are capped by the size of their bound node table.
+    double getNumRelsFromBoundNode(
+        const binder::RelExpression& rel, const binder::NodeExpression& boundNode);
 
 private:
+    const catalog::Catalog& catalog;
     const storage::NodesStatisticsAndDeletedIDs& nodesStatistics;
     const storage::RelsStatistics& relsStatistics;
     // The domain of nodeID is defined as the number of unique value of nodeID, i.e. num nodes.
@@ -13,7 +13,7 @@ class JoinOrderEnumeratorContext {
 public:
     JoinOrderEnumeratorContext()
         : currentLevel{0}, maxLevel{0}, subPlansTable{std::make_unique<SubPlansTable>()},
-          queryGraph{nullptr} {}
+          queryGraph{nullptr}, numEnumeratedPlans{0} {}
 
     void init(QueryGraph* queryGraph, const expression_vector& predicates);
 
@@ -27,6 +27,7 @@ public:
         return subPlansTable->getSubgraphPlans(subqueryGraph);
     }
     inline void addPlan(const SubqueryGraph& subqueryGraph, std::unique_ptr<LogicalPlan> plan) {
+        numEnumeratedPlans++;
         subPlansTable->addPlan(subqueryGraph, std::move(plan));
     }
 
@@ -35,6 +36,10 @@ public:
 
     inline QueryGraph* getQueryGraph() { return queryGraph; }
 
+    inline bool isExactEnumerationBudgetExceeded() const {
+        return numEnumeratedPlans > common::PlannerKnobs::MAX_NUM_PLANS_TO_ENUMERATE_EXACTLY;
+    }
+
     inline bool nodeToScanFromInnerAndOuter(NodeExpression* node) {
         for (auto& nodeID : nodeIDsToScanFromInnerAndOuter) {
             if (nodeID->getUniqueName() == node->getInternalIDPropertyName()) {
@@ -54,6 +59,8 @@ private:
 
     std::unique_ptr<SubPlansTable> subPlansTable;
     QueryGraph* queryGraph;
+    // Number of plans generated while enumerating the current query graph.
+    uint64_t numEnumeratedPlans;
 
     expression_vector nodeIDsToScanFromInnerAndOuter;
 };
@@ -36,6 +36,7 @@ public:
     }
 
 private:
+    bool aggregateOnSameUnFlatGroup();
     bool hasDistinctAggregate();
 
 private:
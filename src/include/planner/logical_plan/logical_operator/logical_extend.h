@@ -22,14 +22,21 @@ public:
 
     inline binder::expression_vector getProperties() const { return properties; }
 
+    // Set when only the number of neighbours, not the neighbours themselves, is consumed above.
+    inline void setCountNbrsOnly() { countNbrsOnly = true; }
+    inline bool isCountNbrsOnly() const { return countNbrsOnly; }
+
     inline std::unique_ptr<LogicalOperator> copy() override {
-        return make_unique<LogicalExtend>(
+        auto extend = make_unique<LogicalExtend>(
             boundNode, nbrNode, rel, direction, properties, hasAtMostOneNbr, children[0]->copy());
+        extend->countNbrsOnly = countNbrsOnly;
+        return extend;
     }
 
 private:
     binder::expression_vector properties;
     bool hasAtMostOneNbr;
+    bool countNbrsOnly = false;
 };
 
 } // namespace planner
@@ -10,8 +10,8 @@ public:
     LogicalOrderBy(binder::expression_vector expressionsToOrderBy, std::vector<bool> sortOrders,
         std::shared_ptr<LogicalOperator> child)
         : LogicalOperator{LogicalOperatorType::ORDER_BY, std::move(child)},
-          expressionsToOrderBy{std::move(expressionsToOrderBy)}, isAscOrders{
-                                                                     std::move(sortOrders)} {}
+          expressionsToOrderBy{std::move(expressionsToOrderBy)},
+          isAscOrders{std::move(sortOrders)}, topN{UINT64_MAX} {}
 
     f_group_pos_set getGroupsPosToFlatten();
 
@@ -26,17 +26,25 @@ public:
         return expressionsToOrderBy;
     }
     inline std::vector<bool> getIsAscOrders() const { return isAscOrders; }
+    // Set if only the first topN tuples of the sorted result are consumed, i.e. ORDER BY is
+    // followed by LIMIT.
+    inline void setTopN(uint64_t n) { topN = n; }
+    inline uint64_t getTopN() const { return topN; }
     inline binder::expression_vector getExpressionsToMaterialize() const {
         return children[0]->getSchema()->getExpressionsInScope();
     }
 
     inline std::unique_ptr<LogicalOperator> copy() override {
-        return make_unique<LogicalOrderBy>(expressionsToOrderBy, isAscOrders, children[0]->copy());
+        auto orderBy =
+            make_unique<LogicalOrderBy>(expressionsToOrderBy, isAscOrders, children[0]->copy());
+        orderBy->topN = topN;
+        return orderBy;
     }
 
 private:
     binder::expression_vector expressionsToOrderBy;
     std::vector<bool> isAscOrders;
+    uint64_t topN;
 };
 
 } // namespace planner
@@ -8,9 +8,11 @@ namespace planner {
 class LogicalUnion : public LogicalOperator {
 public:
     LogicalUnion(binder::expression_vector expressions,
-        std::vector<std::shared_ptr<LogicalOperator>> children)
+        std::vector<std::shared_ptr<LogicalOperator>> children,
+        std::vector<uint32_t> identicalChildIdxes)
         : LogicalOperator{LogicalOperatorType::UNION_ALL, std::move(children)},
-          expressionsToUnion{std::move(expressions)} {}
+          expressionsToUnion{std::move(expressions)}, identicalChildIdxes{
+                                                          std::move(identicalChildIdxes)} {}
 
     f_group_pos_set getGroupsPosToFlatten(uint32_t childIdx);
 
@@ -23,6 +25,10 @@ public:
 
     inline Schema* getSchemaBeforeUnion(uint32_t idx) { return children[idx]->getSchema(); }
 
+    // Returns the index of the first child that produces the same result as the idx-th child, so
+    // that identical children are evaluated only once.
+    inline uint32_t getIdenticalChildIdx(uint32_t idx) const { return identicalChildIdxes[idx]; }
+
     std::unique_ptr<LogicalOperator> copy() override;
 
 private:
@@ -32,6 +38,7 @@ private:
 
 private:
     binder::expression_vector expressionsToUnion;
+    std::vector<uint32_t> identicalChildIdxes;
 };
 
 } // namespace planner
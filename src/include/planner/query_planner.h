@@ -20,7 +20,7 @@ public:
         const storage::NodesStatisticsAndDeletedIDs& nodesStatistics,
         const storage::RelsStatistics& relsStatistics)
         : catalog{catalog}, cardinalityEstimator{std::make_unique<CardinalityEstimator>(
-                                nodesStatistics, relsStatistics)},
+                                catalog, nodesStatistics, relsStatistics)},
           joinOrderEnumerator{catalog, this}, projectionPlanner{this}, updatePlanner{this} {}
 
     std::vector<std::unique_ptr<LogicalPlan>> getAllPlans(const BoundStatement& boundStatement);
@@ -71,7 +71,8 @@ private:
         std::shared_ptr<NodeExpression> node, LogicalPlan& plan);
 
     std::unique_ptr<LogicalPlan> createUnionPlan(
-        std::vector<std::unique_ptr<LogicalPlan>>& childrenPlans, bool isUnionAll);
+        std::vector<std::unique_ptr<LogicalPlan>>& childrenPlans,
+        std::vector<uint32_t> identicalChildIdxes, bool isUnionAll);
 
     static std::vector<std::unique_ptr<LogicalPlan>> getInitialEmptyPlans();
 
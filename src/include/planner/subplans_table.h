@@ -30,6 +30,7 @@ public:
     SubgraphPlans(const SubqueryGraph& subqueryGraph);
 
     inline uint64_t getMaxCost() const { return maxCost; }
+    inline uint64_t getMinCost() const { return minCost; }
 
     void addPlan(std::unique_ptr<LogicalPlan> plan);
 
@@ -40,11 +41,14 @@ private:
     // nodes that are involved in current subgraph.
     std::bitset<MAX_NUM_QUERY_VARIABLES> encodePlan(const LogicalPlan& plan);
 
+    void updateMinMaxCost();
+
 private:
     constexpr static uint32_t MAX_NUM_PLANS = 10;
 
 private:
     uint64_t maxCost = UINT64_MAX;
+    uint64_t minCost = UINT64_MAX;
     binder::expression_vector nodeIDsToEncode;
     std::vector<std::unique_ptr<LogicalPlan>> plans;
     std::unordered_map<std::bitset<MAX_NUM_QUERY_VARIABLES>, common::vector_idx_t>
@@ -52,7 +56,8 @@ private:
 };
 
 // A DPLevel is a collection of plans per subgraph. All subgraph should have the same number of
-// variables.
+// variables. When the number of subgraphs exceeds MAX_NUM_SUBGRAPH, we keep the subgraphs with the
+// cheapest plans, so that approximate enumeration of large queries extends promising subgraphs.
 class DPLevel {
 public:
     inline bool contains(const SubqueryGraph& subqueryGraph) {
@@ -65,10 +70,17 @@ public:
 
     std::vector<SubqueryGraph> getSubqueryGraphs();
 
+    // A plan of a new subgraph must be cheaper than the returned cost to be kept.
+    uint64_t getMaxCostOfNewSubgraph() const;
+
     void addPlan(const SubqueryGraph& subqueryGraph, std::unique_ptr<LogicalPlan> plan);
 
     inline void clear() { subgraph2Plans.clear(); }
 
+private:
+    // Returns false if there is no subgraph whose cheapest plan is more expensive than cost.
+    bool evictMostExpensiveSubgraph(uint64_t cost);
+
 private:
     constexpr static uint32_t MAX_NUM_SUBGRAPH = 50;
 
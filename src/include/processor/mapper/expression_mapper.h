@@ -14,6 +14,11 @@ class PlanMapper;
 class ExpressionMapper {
 
 public:
+    explicit ExpressionMapper(
+        const std::unordered_map<std::string, std::shared_ptr<common::Value>>* parameterMap =
+            nullptr)
+        : parameterMap{parameterMap} {}
+
     std::unique_ptr<evaluator::BaseExpressionEvaluator> mapExpression(
         const std::shared_ptr<binder::Expression>& expression, const planner::Schema& schema);
 
@@ -32,6 +37,11 @@ private:
 
     std::unique_ptr<evaluator::BaseExpressionEvaluator> mapFunctionExpression(
         const std::shared_ptr<binder::Expression>& expression, const planner::Schema& schema);
+
+private:
+    // Values of the parameters of the statement being mapped. Cached logical plans are shared by
+    // prepared statements, so parameters are looked up here instead of in the plan's expressions.
+    const std::unordered_map<std::string, std::shared_ptr<common::Value>>* parameterMap;
 };
 
 } // namespace processor
@@ -16,11 +16,14 @@ struct BuildDataInfo;
 
 class PlanMapper {
 public:
-    // Create plan mapper with default mapper context.
+    // Create plan mapper with default mapper context. Parameters are read from parameterMap if
+    // given, otherwise from the parameter expressions of the logical plan.
     PlanMapper(storage::StorageManager& storageManager, storage::MemoryManager* memoryManager,
-        catalog::Catalog* catalog)
+        catalog::Catalog* catalog,
+        const std::unordered_map<std::string, std::shared_ptr<common::Value>>* parameterMap =
+            nullptr)
         : storageManager{storageManager}, memoryManager{memoryManager},
-          expressionMapper{}, catalog{catalog}, physicalOperatorID{0} {}
+          expressionMapper{parameterMap}, catalog{catalog}, physicalOperatorID{0} {}
 
     std::unique_ptr<PhysicalPlan> mapLogicalPlanToPhysical(planner::LogicalPlan* logicalPlan,
         const binder::expression_vector& expressionsToCollect, common::StatementType statementType);
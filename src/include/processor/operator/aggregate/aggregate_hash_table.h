@@ -29,13 +29,18 @@ struct HashSlot {
  * Linear probing. When collision happens, we find the next hash slot whose entry is a
  * nullptr.
  *
+ * 4. Fixed-sized key
+ * If there is a single unflat hash key of a fixed-sized type without nulls, we probe with a type
+ * specialized loop that compares keys inline and writes the key of a new entry right away,
+ * instead of resolving collisions in rounds over all keys with type-erased compare functions.
+ *
  */
 class AggregateHashTable;
-using compare_function_t = std::function<bool(const uint8_t*, const uint8_t*)>;
-using update_agg_function_t =
-    std::function<void(AggregateHashTable*, const std::vector<common::ValueVector*>&,
-        const std::vector<common::ValueVector*>&, std::unique_ptr<function::AggregateFunction>&,
-        common::ValueVector*, uint64_t, uint32_t, uint32_t)>;
+using compare_function_t = bool (*)(const uint8_t*, const uint8_t*);
+using update_agg_function_t = void (AggregateHashTable::*)(
+    const std::vector<common::ValueVector*>&, const std::vector<common::ValueVector*>&,
+    std::unique_ptr<function::AggregateFunction>&, common::ValueVector*, uint64_t, uint32_t,
+    uint32_t);
 
 class AggregateHashTable : public BaseHashTable {
 public:
@@ -120,6 +125,15 @@ private:
         const std::vector<common::ValueVector*>& groupByUnflatHashKeyVectors,
         const std::vector<common::ValueVector*>& groupByNonHashKeyVectors);
 
+    bool canFindHashSlotsWithFixedSizeKey(common::ValueVector* groupByHashKeyVector) const;
+
+    void findHashSlotsWithFixedSizeKey(common::ValueVector* groupByHashKeyVector,
+        const std::vector<common::ValueVector*>& groupByNonHashKeyVectors);
+
+    template<typename T>
+    void findHashSlotsWithFixedSizeKey(common::ValueVector* groupByHashKeyVector,
+        const std::vector<common::ValueVector*>& groupByNonHashKeyVectors);
+
     void computeAndCombineVecHash(
         const std::vector<common::ValueVector*>& groupByUnflatHashKeyVectors, uint32_t startVecIdx);
     void computeVectorHashes(const std::vector<common::ValueVector*>& groupByFlatHashKeyVectors,
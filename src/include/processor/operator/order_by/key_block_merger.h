@@ -1,5 +1,6 @@
 #pragma once
 
+#include <condition_variable>
 #include <queue>
 
 #include "processor/operator/order_by/order_by_key_encoder.h"
@@ -12,17 +13,31 @@ struct KeyBlockMergeMorsel;
 // This struct stores the string key column information. We can utilize the
 // pre-computed indexes and offsets to expedite the tuple comparison in merge sort.
 struct StrKeyColInfo {
-    StrKeyColInfo(uint32_t colOffsetInFT, uint32_t colOffsetInEncodedKeyBlock, bool isAscOrder)
+    StrKeyColInfo(uint32_t colOffsetInFT, uint32_t colOffsetInEncodedKeyBlock, bool isAscOrder,
+        uint32_t strKeyPrefixLength =
+            common::ClientContextConstants::ORDER_BY_STRING_KEY_PREFIX_LENGTH)
         : colOffsetInFT{colOffsetInFT}, colOffsetInEncodedKeyBlock{colOffsetInEncodedKeyBlock},
-          isAscOrder{isAscOrder} {}
+          isAscOrder{isAscOrder}, strKeyPrefixLength{strKeyPrefixLength} {}
 
     inline uint32_t getEncodingSize() const {
-        return OrderByKeyEncoder::getEncodingSize(common::DataType(common::STRING));
+        return OrderByKeyEncoder::getEncodingSize(
+            common::DataType(common::STRING), strKeyPrefixLength);
+    }
+
+    // The following functions take a pointer to the beginning of an encoded tuple.
+    inline bool isNull(const uint8_t* tuplePtr) const {
+        return OrderByKeyEncoder::isNullVal(tuplePtr + colOffsetInEncodedKeyBlock, isAscOrder);
+    }
+
+    inline bool isLongStr(const uint8_t* tuplePtr) const {
+        return OrderByKeyEncoder::isLongStr(
+            tuplePtr + colOffsetInEncodedKeyBlock, isAscOrder, strKeyPrefixLength);
     }
 
     uint32_t colOffsetInFT;
     uint32_t colOffsetInEncodedKeyBlock;
     bool isAscOrder;
+    uint32_t strKeyPrefixLength;
 };
 
 class MergedKeyBlocks {
@@ -149,7 +164,7 @@ public:
     }
 
 private:
-    uint64_t findRightKeyBlockIdx(uint8_t* leftEndTuplePtr);
+    uint64_t findLeftKeyBlockEndIdx(uint64_t resultEndIdx);
 
 public:
     static const uint32_t batch_size = 10000;
@@ -163,7 +178,7 @@ public:
     // If the counter is 0 and there is no morsel left in the current task, we can
     // put the resultKeyBlock back to the keyBlock list.
     uint64_t activeMorsels;
-    // KeyBlockMerger is used to compare the values of two tuples during the binary search.
+    // KeyBlockMerger is used to compare the values of two tuples during the merge path search.
     KeyBlockMerger& keyBlockMerger;
 };
 
@@ -187,11 +202,10 @@ class KeyBlockMergeTaskDispatcher {
 public:
     inline bool isDoneMerge() {
         std::lock_guard<std::mutex> keyBlockMergeDispatcherLock{mtx};
-        // Returns true if there are no more merge task to do or the sortedKeyBlocks is empty
-        // (meaning that the resultSet is empty).
-        return sortedKeyBlocks->size() <= 1 && activeKeyBlockMergeTasks.empty();
+        return isDoneMergeNoLock();
     }
 
+    // Blocks until there is a morsel to merge. Returns nullptr once all merge tasks are done.
     std::unique_ptr<KeyBlockMergeMorsel> getMorsel();
 
     void doneMorsel(std::unique_ptr<KeyBlockMergeMorsel> morsel);
@@ -203,8 +217,18 @@ public:
         std::vector<std::shared_ptr<FactorizedTable>>& factorizedTables,
         std::vector<StrKeyColInfo>& strKeyColsInfo, uint64_t numBytesPerTuple);
 
+private:
+    inline bool isDoneMergeNoLock() {
+        // Returns true if there are no more merge task to do or the sortedKeyBlocks is empty
+        // (meaning that the resultSet is empty).
+        return sortedKeyBlocks->size() <= 1 && activeKeyBlockMergeTasks.empty();
+    }
+
 private:
     std::mutex mtx;
+    // Notified when a merge task finishes, which may make a new merge task or the end of the merge
+    // available to threads waiting in getMorsel().
+    std::condition_variable mergeTaskFinished;
 
     storage::MemoryManager* memoryManager;
     std::shared_ptr<std::queue<std::shared_ptr<MergedKeyBlocks>>> sortedKeyBlocks;
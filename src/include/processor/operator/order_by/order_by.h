@@ -12,6 +12,17 @@
 namespace kuzu {
 namespace processor {
 
+// A range of the fully merged key block scanned by an OrderByScan. Morsels are numbered in the
+// order of the key block, so that the consumer of a parallel scan can restore the order.
+struct OrderByScanMorsel {
+    OrderByScanMorsel(uint64_t morselIdx, uint64_t startTupleIdx, uint64_t endTupleIdx)
+        : morselIdx{morselIdx}, startTupleIdx{startTupleIdx}, endTupleIdx{endTupleIdx} {}
+
+    uint64_t morselIdx;
+    uint64_t startTupleIdx;
+    uint64_t endTupleIdx;
+};
+
 // This class contains factorizedTables, nextFactorizedTableIdx, strKeyColsInfo,
 // sortedKeyBlocks and the size of each tuple in keyBlocks. The class is shared between the
 // order_by, orderByMerge, orderByScan operators. All functions are guaranteed to be thread-safe, so
@@ -20,7 +31,8 @@ class SharedFactorizedTablesAndSortedKeyBlocks {
 public:
     explicit SharedFactorizedTablesAndSortedKeyBlocks()
         : nextFactorizedTableIdx{0},
-          sortedKeyBlocks{std::make_shared<std::queue<std::shared_ptr<MergedKeyBlocks>>>()} {}
+          sortedKeyBlocks{std::make_shared<std::queue<std::shared_ptr<MergedKeyBlocks>>>()},
+          nextScanMorselIdx{0}, nextTupleIdxToScan{0} {}
 
     uint8_t getNextFactorizedTableIdx() {
         std::unique_lock lck{mtx};
@@ -48,6 +60,10 @@ public:
         numBytesPerTuple = _numBytesPerTuple;
     }
 
+    void setStrKeyPrefixLength(uint32_t _strKeyPrefixLength) {
+        strKeyPrefixLength = _strKeyPrefixLength;
+    }
+
     void combineFTHasNoNullGuarantee() {
         for (auto i = 1u; i < factorizedTables.size(); i++) {
             factorizedTables[0]->mergeMayContainNulls(*factorizedTables[i]);
@@ -59,8 +75,27 @@ public:
         strKeyColsInfo = std::move(_strKeyColsInfo);
     }
 
+    // Returns nullptr once the merged key block is fully scanned.
+    std::unique_ptr<OrderByScanMorsel> getScanMorsel() {
+        std::unique_lock lck{mtx};
+        auto numTuples = sortedKeyBlocks->empty() ? 0 : sortedKeyBlocks->front()->getNumTuples();
+        if (nextTupleIdxToScan >= numTuples) {
+            return nullptr;
+        }
+        auto endTupleIdx = std::min(nextTupleIdxToScan + SCAN_MORSEL_SIZE, numTuples);
+        auto morsel = std::make_unique<OrderByScanMorsel>(
+            nextScanMorselIdx++, nextTupleIdxToScan, endTupleIdx);
+        nextTupleIdxToScan = endTupleIdx;
+        return morsel;
+    }
+
 private:
+    // Large morsels keep the number of local result tables small when the scan runs in parallel.
+    static constexpr uint64_t SCAN_MORSEL_SIZE = 32 * common::DEFAULT_VECTOR_CAPACITY;
+
     std::mutex mtx;
+    uint64_t nextScanMorselIdx;
+    uint64_t nextTupleIdxToScan;
 
 public:
     std::vector<std::shared_ptr<FactorizedTable>> factorizedTables;
@@ -68,6 +103,7 @@ public:
     std::shared_ptr<std::queue<std::shared_ptr<MergedKeyBlocks>>> sortedKeyBlocks;
 
     uint32_t numBytesPerTuple = UINT32_MAX; // encoding size
+    uint32_t strKeyPrefixLength = common::ClientContextConstants::ORDER_BY_STRING_KEY_PREFIX_LENGTH;
     std::vector<StrKeyColInfo> strKeyColsInfo;
 };
 
@@ -98,11 +134,11 @@ class OrderBy : public Sink {
 public:
     OrderBy(std::unique_ptr<ResultSetDescriptor> resultSetDescriptor,
         const OrderByDataInfo& orderByDataInfo,
-        std::shared_ptr<SharedFactorizedTablesAndSortedKeyBlocks> sharedState,
+        std::shared_ptr<SharedFactorizedTablesAndSortedKeyBlocks> sharedState, uint64_t topN,
         std::unique_ptr<PhysicalOperator> child, uint32_t id, const std::string& paramsString)
         : Sink{std::move(resultSetDescriptor), PhysicalOperatorType::ORDER_BY, std::move(child), id,
               paramsString},
-          orderByDataInfo{orderByDataInfo}, sharedState{std::move(sharedState)} {}
+          orderByDataInfo{orderByDataInfo}, sharedState{std::move(sharedState)}, topN{topN} {}
 
     void initLocalStateInternal(ResultSet* resultSet, ExecutionContext* context) override;
 
@@ -118,7 +154,7 @@ public:
 
     std::unique_ptr<PhysicalOperator> clone() override {
         return std::make_unique<OrderBy>(resultSetDescriptor->copy(), orderByDataInfo, sharedState,
-            children[0]->clone(), id, paramsString);
+            topN, children[0]->clone(), id, paramsString);
     }
 
 private:
@@ -135,6 +171,8 @@ private:
     std::vector<common::ValueVector*> vectorsToAppend;
     std::shared_ptr<SharedFactorizedTablesAndSortedKeyBlocks> sharedState;
     std::shared_ptr<FactorizedTable> localFactorizedTable;
+    // Number of leading tuples of the sorted result that are consumed. UINT64_MAX if unbounded.
+    uint64_t topN;
 };
 
 } // namespace processor
@@ -39,6 +39,9 @@ namespace processor {
 // and negative numbers. So the final encoding for 73(INT64) and 38(INT64) as an 8-byte binary
 // string is: 73=0x8000000000000049 38=0x8000000000000026. To handle the null in comparison, we
 // add an extra byte(called the NULL flag) to represent whether this value is null or not.
+// Strings are encoded as a prefix of configurable length followed by a flag telling whether the
+// string is longer than the prefix. Only strings longer than the prefix need to be compared against
+// the full strings stored in the factorizedTable when their encodings are equal.
 
 using encode_function_t = std::function<void(const uint8_t*, uint8_t*, bool)>;
 
@@ -47,7 +50,9 @@ class OrderByKeyEncoder {
 public:
     OrderByKeyEncoder(std::vector<common::ValueVector*>& orderByVectors,
         std::vector<bool>& isAscOrder, storage::MemoryManager* memoryManager, uint8_t ftIdx,
-        uint32_t numTuplesPerBlockInFT, uint32_t numBytesPerTuple);
+        uint32_t numTuplesPerBlockInFT, uint32_t numBytesPerTuple,
+        uint32_t strKeyPrefixLength =
+            common::ClientContextConstants::ORDER_BY_STRING_KEY_PREFIX_LENGTH);
 
     inline std::vector<std::shared_ptr<DataBlock>>& getKeyBlocks() { return keyBlocks; }
 
@@ -57,7 +62,9 @@ public:
 
     inline uint32_t getNumTuplesInCurBlock() const { return keyBlocks.back()->numTuples; }
 
-    static uint32_t getNumBytesPerTuple(const std::vector<common::ValueVector*>& keyVectors);
+    static uint32_t getNumBytesPerTuple(const std::vector<common::ValueVector*>& keyVectors,
+        uint32_t strKeyPrefixLength =
+            common::ClientContextConstants::ORDER_BY_STRING_KEY_PREFIX_LENGTH);
 
     static inline uint32_t getEncodedFTBlockIdx(const uint8_t* tupleInfoPtr) {
         return *(uint32_t*)tupleInfoPtr;
@@ -77,14 +84,15 @@ public:
         return *(nullBytePtr) == (isAscOrder ? UINT8_MAX : 0);
     }
 
-    static inline bool isLongStr(const uint8_t* strBuffer, bool isAsc) {
-        return *(strBuffer + 13) == (isAsc ? UINT8_MAX : 0);
+    static inline bool isLongStr(const uint8_t* strBuffer, bool isAsc,
+        uint32_t strKeyPrefixLength =
+            common::ClientContextConstants::ORDER_BY_STRING_KEY_PREFIX_LENGTH) {
+        return *(strBuffer + 1 + strKeyPrefixLength) == (isAsc ? UINT8_MAX : 0);
     }
 
-    static uint32_t getNumBytesPerTuple(
-        const std::vector<std::shared_ptr<common::ValueVector>>& keyVectors);
-
-    static uint32_t getEncodingSize(const common::DataType& dataType);
+    static uint32_t getEncodingSize(const common::DataType& dataType,
+        uint32_t strKeyPrefixLength =
+            common::ClientContextConstants::ORDER_BY_STRING_KEY_PREFIX_LENGTH);
 
     void encodeKeys();
 
@@ -101,6 +109,9 @@ private:
         assert(false);
     }
 
+    static void encodeString(
+        const common::ku_string_t& data, uint8_t* resultPtr, uint32_t strKeyPrefixLength);
+
     void flipBytesIfNecessary(
         uint32_t keyColIdx, uint8_t* tuplePtr, uint32_t numEntriesToEncode, common::DataType& type);
 
@@ -116,7 +127,7 @@ private:
 
     void allocateMemoryIfFull();
 
-    static encode_function_t getEncodingFunction(common::DataTypeID typeId);
+    encode_function_t getEncodingFunction(common::DataTypeID typeId) const;
 
 private:
     storage::MemoryManager* memoryManager;
@@ -124,6 +135,7 @@ private:
     std::vector<common::ValueVector*>& orderByVectors;
     std::vector<bool> isAscOrder;
     uint32_t numBytesPerTuple;
+    uint32_t strKeyPrefixLength;
     uint32_t maxNumTuplesPerBlock;
     uint32_t ftBlockIdx = 0;
     // Since we encode 3 bytes for ftBlockOffset, the maxFTBlockOffset is 2^24 - 1.
@@ -8,7 +8,9 @@ namespace processor {
 
 struct MergedKeyBlockScanState {
     bool scanSingleTuple;
-    uint32_t nextTupleIdxToReadInMergedKeyBlock;
+    uint64_t morselIdx;
+    uint64_t nextTupleIdxToReadInMergedKeyBlock;
+    uint64_t endTupleIdxToReadInMergedKeyBlock;
     std::shared_ptr<MergedKeyBlocks> mergedKeyBlock;
     uint32_t tupleIdxAndFactorizedTableIdxOffset;
     std::vector<uint32_t> colsToScan;
@@ -16,8 +18,9 @@ struct MergedKeyBlockScanState {
     std::unique_ptr<BlockPtrInfo> blockPtrInfo;
 };
 
-// To preserve the ordering of tuples, the orderByScan operator will only
-// be executed in single-thread mode.
+// Threads scan the merged key block in morsels of consecutive tuples. The order of tuples is
+// preserved within a morsel, so the orderByScan operator is executed in single-thread mode unless
+// its consumer restores the order across morsels (see ResultCollector).
 class OrderByScan : public PhysicalOperator {
 public:
     OrderByScan(std::vector<DataPos> outVectorPos,
@@ -43,8 +46,12 @@ public:
         return std::make_unique<OrderByScan>(outVectorPos, sharedState, id, paramsString);
     }
 
+    // Index of the morsel that the last output tuples belong to.
+    inline uint64_t getMorselIdx() const { return mergedKeyBlockScanState->morselIdx; }
+
 private:
     void initMergedKeyBlockScanState();
+    bool getNextMorsel();
 
 private:
     std::vector<DataPos> outVectorPos;
@@ -1,5 +1,6 @@
 #pragma once
 
+#include "common/task_system/task.h"
 #include "processor/data_pos.h"
 #include "processor/execution_context.h"
 #include "processor/result/result_set.h"
@@ -43,6 +44,7 @@ enum class PhysicalOperatorType : uint8_t {
     SCAN_REL_PROPERTY,
     SCAN_REL_TABLE_COLUMNS,
     SCAN_REL_TABLE_LISTS,
+    SCAN_REL_TABLE_LISTS_DEGREE,
     SCAN_BFS_LEVEL,
     SEMI_MASKER,
     SET_NODE_PROPERTY,
@@ -99,6 +101,11 @@ public:
 
     inline virtual bool isSource() const { return false; }
     inline virtual bool isSink() const { return false; }
+    // Whether a source grabs exactly one morsel from its shared state per getNextTuple() call, so
+    // a thread can leave the rest of the source to other threads between these calls.
+    inline virtual bool canYieldBetweenMorsels() const { return false; }
+    // Makes getNextTuple() return false if the task asked the calling thread to yield.
+    inline void setTaskToYield(common::Task* task) { taskToYield = task; }
 
     inline void addChild(std::unique_ptr<PhysicalOperator> op) {
         children.push_back(std::move(op));
@@ -118,6 +125,9 @@ public:
         if (context->clientContext->isInterrupted()) {
             throw common::InterruptException{};
         }
+        if (taskToYield != nullptr && taskToYield->yieldThreadIfRequested()) {
+            return false;
+        }
         metrics->executionTime.start();
         auto result = getNextTuplesInternal(context);
         metrics->executionTime.stop();
@@ -154,6 +164,7 @@ protected:
     ResultSet* resultSet;
 
     std::string paramsString;
+    common::Task* taskToYield = nullptr;
 };
 
 } // namespace processor
@@ -1,5 +1,8 @@
 #pragma once
 
+#include <map>
+
+#include "processor/operator/order_by/order_by_scan.h"
 #include "processor/operator/sink.h"
 #include "processor/result/factorized_table.h"
 
@@ -25,6 +28,10 @@ public:
         std::lock_guard<std::mutex> lck{mtx};
         table->merge(localTable);
     }
+    // Merges the local tables of an ordered scan in the order of their morsels. A local table that
+    // arrives before the tables of its preceding morsels is kept until they are merged.
+    void mergeLocalTable(uint64_t morselIdx, std::unique_ptr<FactorizedTable> localTable);
+    void assertAllLocalTablesMerged();
 
     inline std::shared_ptr<FactorizedTable> getTable() { return table; }
 
@@ -39,6 +46,8 @@ private:
     std::shared_ptr<FactorizedTable> table;
 
     uint64_t nextTupleIdxToScan = 0u;
+    uint64_t nextMorselIdxToMerge = 0u;
+    std::map<uint64_t, std::unique_ptr<FactorizedTable>> pendingLocalTables;
 };
 
 class ResultCollector : public Sink {
@@ -56,6 +65,8 @@ public:
 
     void executeInternal(ExecutionContext* context) override;
 
+    void finalize(ExecutionContext* context) override;
+
     std::unique_ptr<PhysicalOperator> clone() override {
         return make_unique<ResultCollector>(resultSetDescriptor->copy(), payloadsPosAndType,
             isPayloadFlat, sharedState, children[0]->clone(), id, paramsString);
@@ -66,9 +77,19 @@ public:
         return sharedState->getTable();
     }
 
+    // The result collector restores the order of an order by scan that feeds it through
+    // projections only, so such a scan can run in parallel.
+    inline bool canCollectInScanOrder() const {
+        return getOrderByScan(children[0].get()) != nullptr;
+    }
+
 private:
     void initGlobalStateInternal(ExecutionContext* context) override;
 
+    static OrderByScan* getOrderByScan(PhysicalOperator* op);
+
+    void mergeLocalTable(ExecutionContext* context);
+
     std::unique_ptr<FactorizedTableSchema> populateTableSchema();
 
 private:
@@ -77,6 +98,9 @@ private:
     std::vector<common::ValueVector*> vectorsToCollect;
     std::shared_ptr<FTableSharedState> sharedState;
     std::unique_ptr<FactorizedTable> localTable;
+    // Set if the tuples are collected in the order of an order by scan.
+    OrderByScan* orderByScan = nullptr;
+    uint64_t localTableMorselIdx = UINT64_MAX;
 };
 
 } // namespace processor
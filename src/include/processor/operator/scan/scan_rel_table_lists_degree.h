@@ -0,0 +1,35 @@
+#pragma once
+
+#include "processor/operator/scan/scan_rel_table.h"
+#include "storage/storage_structure/lists/lists.h"
+
+namespace kuzu {
+namespace processor {
+
+// Replaces ScanRelTableLists when the neighbours are discarded above. Instead of scanning the
+// adjacency list of each bound node, the operator reads the list size from the list headers (and
+// the local updates of a write transaction) and multiplies it into the result set multiplicity.
+class ScanRelTableListsDegree : public ScanRelTable {
+public:
+    ScanRelTableListsDegree(storage::AdjLists* adjLists, const DataPos& inNodeIDVectorPos,
+        std::vector<DataPos> outputVectorsPos, std::unique_ptr<PhysicalOperator> child,
+        uint32_t id, const std::string& paramsString)
+        : ScanRelTable{inNodeIDVectorPos, std::move(outputVectorsPos),
+              PhysicalOperatorType::SCAN_REL_TABLE_LISTS_DEGREE, std::move(child), id,
+              paramsString},
+          adjLists{adjLists}, prevMultiplicity{1} {}
+
+    bool getNextTuplesInternal(ExecutionContext* context) override;
+
+    inline std::unique_ptr<PhysicalOperator> clone() override {
+        return make_unique<ScanRelTableListsDegree>(adjLists, inNodeIDVectorPos, outputVectorsPos,
+            children[0]->clone(), id, paramsString);
+    }
+
+private:
+    storage::AdjLists* adjLists;
+    uint64_t prevMultiplicity;
+};
+
+} // namespace processor
+} // namespace kuzu
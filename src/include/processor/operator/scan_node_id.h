@@ -130,7 +130,9 @@ public:
           outDataPos{outDataPos}, sharedState{std::move(sharedState)} {}
 
     bool isSource() const override { return true; }
+    bool canYieldBetweenMorsels() const override { return true; }
 
+    inline DataPos getOutDataPos() const { return outDataPos; }
     inline ScanNodeIDSharedState* getSharedState() const { return sharedState.get(); }
 
     void initLocalStateInternal(ResultSet* resultSet, ExecutionContext* context) override;
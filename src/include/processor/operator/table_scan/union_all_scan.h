@@ -10,15 +10,19 @@ class UnionAllScanSharedState {
 public:
     explicit UnionAllScanSharedState(
         std::vector<std::shared_ptr<FTableSharedState>> fTableSharedStates)
-        : fTableSharedStates{std::move(fTableSharedStates)}, fTableToScanIdx{0} {}
+        : fTableSharedStates{std::move(fTableSharedStates)}, fTableToScanIdx{0},
+          nextTupleIdxToScan{0} {}
 
     uint64_t getMaxMorselSize() const;
     std::unique_ptr<FTableScanMorsel> getMorsel(uint64_t maxMorselSize);
 
 private:
     std::mutex mtx;
+    // The same table may appear multiple times if the union has identical children, so we keep
+    // track of the scan position here instead of using the scan state of each FTableSharedState.
     std::vector<std::shared_ptr<FTableSharedState>> fTableSharedStates;
     uint64_t fTableToScanIdx;
+    uint64_t nextTupleIdxToScan;
 };
 
 class UnionAllScan : public BaseTableScan {
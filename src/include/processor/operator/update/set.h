@@ -32,6 +32,9 @@ public:
 
     ~SetNodeProperty() override = default;
 
+    // Returns true if all updated nodes are read from nodeIDPos.
+    bool updatesOnlyNodesAt(const DataPos& nodeIDPos) const;
+
     void initLocalStateInternal(ResultSet* resultSet, ExecutionContext* context) override;
 
     bool getNextTuplesInternal(ExecutionContext* context) override;
@@ -68,7 +71,7 @@ class SetRelProperty : public PhysicalOperator {
 public:
     SetRelProperty(std::vector<std::unique_ptr<SetRelPropertyInfo>> infos,
         std::unique_ptr<PhysicalOperator> child, uint32_t id, const std::string& paramsString)
-        : PhysicalOperator{PhysicalOperatorType::SET_NODE_PROPERTY, std::move(child), id,
+        : PhysicalOperator{PhysicalOperatorType::SET_REL_PROPERTY, std::move(child), id,
               paramsString},
           infos{std::move(infos)} {}
 
@@ -10,6 +10,8 @@
 namespace kuzu {
 namespace processor {
 
+class SetNodeProperty;
+
 class QueryProcessor {
 
 public:
@@ -17,10 +19,14 @@ public:
 
     std::shared_ptr<FactorizedTable> execute(PhysicalPlan* physicalPlan, ExecutionContext* context);
 
+    inline common::TaskScheduler* getTaskScheduler() { return taskScheduler.get(); }
+
 private:
     void decomposePlanIntoTasks(PhysicalOperator* op, PhysicalOperator* parent,
         common::Task* parentTask, ExecutionContext* context);
 
+    static bool canSetNodePropertyInParallel(SetNodeProperty* setNodeProperty);
+
     static std::shared_ptr<FactorizedTable> getFactorizedTableForOutputMsg(
         std::string& outputMsg, storage::MemoryManager* memoryManager);
 
@@ -9,12 +9,21 @@ namespace processor {
 class ProcessorTask : public common::Task {
 public:
     ProcessorTask(Sink* sink, ExecutionContext* executionContext)
-        : Task{executionContext->numThreads}, sink{sink}, executionContext{executionContext} {}
+        : Task{executionContext->numThreads}, sink{sink}, executionContext{executionContext} {
+        setPriority(executionContext->clientContext->getQueryPriority());
+    }
 
     void run() override;
     void finalizeIfNecessary() override;
+    // A thread can yield between the morsels of the pipeline source, unless the pipeline must run
+    // in a single thread.
+    bool canYield() const override;
+
+    inline Sink* getSink() const { return sink; }
 
 private:
+    static PhysicalOperator* getPipelineSource(PhysicalOperator* op);
+
     static std::unique_ptr<ResultSet> populateResultSet(
         Sink* op, storage::MemoryManager* memoryManager);
 
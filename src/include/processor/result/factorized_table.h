@@ -20,10 +20,13 @@ typedef uint32_t ft_block_idx_t;
 typedef uint32_t ft_block_offset_t;
 
 struct BlockAppendingInfo {
-    BlockAppendingInfo(uint8_t* data, uint64_t numTuplesToAppend)
-        : data{data}, numTuplesToAppend{numTuplesToAppend} {}
+    BlockAppendingInfo(uint8_t* data, ft_block_offset_t blockOffset, uint64_t numTuplesToAppend)
+        : data{data}, blockOffset{blockOffset}, numTuplesToAppend{numTuplesToAppend} {}
 
+    // Start of the block to append to.
     uint8_t* data;
+    // Offset of the first appended tuple in the block.
+    ft_block_offset_t blockOffset;
     uint64_t numTuplesToAppend;
 };
 
@@ -66,8 +69,13 @@ public:
     // This interface is used for unflat tuple blocks, for which numBytesPerTuple and
     // numTuplesPerBlock are useless.
     DataBlockCollection() : numBytesPerTuple{UINT32_MAX}, numTuplesPerBlock{UINT32_MAX} {}
-    DataBlockCollection(uint32_t numBytesPerTuple, uint32_t numTuplesPerBlock)
-        : numBytesPerTuple{numBytesPerTuple}, numTuplesPerBlock{numTuplesPerBlock} {}
+    // If minipageValueSizes is not empty, blocks are in the columnar layout: each block is split
+    // into minipages, and the i-th minipage stores numTuplesPerBlock values of
+    // minipageValueSizes[i] bytes.
+    DataBlockCollection(uint32_t numBytesPerTuple, uint32_t numTuplesPerBlock,
+        std::vector<uint32_t> minipageValueSizes = {})
+        : numBytesPerTuple{numBytesPerTuple}, numTuplesPerBlock{numTuplesPerBlock},
+          minipageValueSizes{std::move(minipageValueSizes)} {}
 
     inline void append(std::unique_ptr<DataBlock> otherBlock) {
         blocks.push_back(std::move(otherBlock));
@@ -84,10 +92,19 @@ public:
     inline uint64_t getNumBlocks() const { return blocks.size(); }
 
     void merge(DataBlockCollection& other);
+    // Unlike merge(), keeps the tuples of other after the tuples of this collection. This shifts
+    // all tuples of other if the last block of this collection is not full.
+    void mergeInOrder(DataBlockCollection& other);
+
+private:
+    void copyTuples(DataBlock* blockToCopyFrom, ft_block_offset_t blockOffsetToCopyFrom,
+        DataBlock* blockToCopyInto, ft_block_offset_t blockOffsetToCopyTo,
+        uint32_t numTuplesToCopy);
 
 private:
     uint32_t numBytesPerTuple;
     uint32_t numTuplesPerBlock;
+    std::vector<uint32_t> minipageValueSizes;
     std::vector<std::unique_ptr<DataBlock>> blocks;
 };
 
@@ -140,6 +157,8 @@ public:
 
     inline ft_col_offset_t getNullMapOffset() const { return numBytesForDataPerTuple; }
 
+    inline uint32_t getNumBytesForNullMapPerTuple() const { return numBytesForNullMapPerTuple; }
+
     inline uint32_t getNumBytesPerTuple() const { return numBytesPerTuple; }
 
     inline ft_col_offset_t getColOffset(ft_col_idx_t idx) const { return colOffsets[idx]; }
@@ -155,6 +174,12 @@ public:
 
     inline bool isEmpty() const { return columns.empty(); }
 
+    // In the columnar layout, the values of each column in a block are stored contiguously, which
+    // makes scanning a few columns of many tuples cheaper. Tables in the columnar layout can only
+    // be accessed through tuple indexes, not through tuple pointers.
+    inline void setColumnar(bool columnar_) { columnar = columnar_; }
+    inline bool isColumnar() const { return columnar; }
+
     bool operator==(const FactorizedTableSchema& other) const;
     inline bool operator!=(const FactorizedTableSchema& other) const { return !(*this == other); }
 
@@ -164,6 +189,7 @@ private:
     uint32_t numBytesForNullMapPerTuple = 0;
     uint32_t numBytesPerTuple = 0;
     std::vector<ft_col_offset_t> colOffsets;
+    bool columnar = false;
 };
 
 class FlatTupleIterator;
@@ -208,6 +234,9 @@ public:
     // other factorizedTable.
     void mergeMayContainNulls(FactorizedTable& other);
     void merge(FactorizedTable& other);
+    // Appends the tuples of other after the tuples of this table. merge() is cheaper but may
+    // interleave the tuples of the two tables.
+    void mergeInOrder(FactorizedTable& other);
 
     inline common::InMemOverflowBuffer* getInMemOverflowBuffer() const {
         return inMemOverflowBuffer.get();
@@ -235,6 +264,9 @@ public:
     }
 
     uint8_t* getTuple(ft_tuple_idx_t tupleIdx) const;
+    // Unlike getTuple(), these functions support both layouts.
+    uint8_t* getCellPtr(ft_tuple_idx_t tupleIdx, ft_col_idx_t colIdx) const;
+    uint8_t* getNullMapPtr(ft_tuple_idx_t tupleIdx) const;
 
     void updateFlatCell(
         uint8_t* tuplePtr, ft_col_idx_t colIdx, common::ValueVector* valueVector, uint32_t pos);
@@ -273,14 +305,41 @@ private:
 
     inline uint8_t* getCell(
         ft_block_idx_t blockIdx, ft_block_offset_t blockOffset, ft_col_offset_t colOffset) const {
+        assert(!tableSchema->isColumnar());
         return flatTupleBlockCollection->getBlock(blockIdx)->getData() +
                blockOffset * tableSchema->getNumBytesPerTuple() + colOffset;
     }
+    // In the row layout, the cells of a tuple are adjacent and the cells of a column are
+    // numBytesPerTuple apart. In the columnar layout, the cells of a column are adjacent.
+    inline uint8_t* getCellInBlock(
+        uint8_t* blockData, ft_block_offset_t blockOffset, ft_col_idx_t colIdx) const {
+        return tableSchema->isColumnar() ?
+                   blockData + numTuplesPerBlock * tableSchema->getColOffset(colIdx) +
+                       blockOffset * tableSchema->getColumn(colIdx)->getNumBytes() :
+                   blockData + blockOffset * tableSchema->getNumBytesPerTuple() +
+                       tableSchema->getColOffset(colIdx);
+    }
+    inline uint8_t* getNullMapInBlock(uint8_t* blockData, ft_block_offset_t blockOffset) const {
+        return tableSchema->isColumnar() ?
+                   blockData + numTuplesPerBlock * tableSchema->getNullMapOffset() +
+                       blockOffset * tableSchema->getNumBytesForNullMapPerTuple() :
+                   blockData + blockOffset * tableSchema->getNumBytesPerTuple() +
+                       tableSchema->getNullMapOffset();
+    }
+    inline uint32_t getCellStride(ft_col_idx_t colIdx) const {
+        return tableSchema->isColumnar() ? tableSchema->getColumn(colIdx)->getNumBytes() :
+                                           tableSchema->getNumBytesPerTuple();
+    }
+    inline uint32_t getNullMapStride() const {
+        return tableSchema->isColumnar() ? tableSchema->getNumBytesForNullMapPerTuple() :
+                                           tableSchema->getNumBytesPerTuple();
+    }
     inline std::pair<ft_block_idx_t, ft_block_offset_t> getBlockIdxAndTupleIdxInBlock(
         uint64_t tupleIdx) const {
         return std::make_pair(tupleIdx / numTuplesPerBlock, tupleIdx % numTuplesPerBlock);
     }
 
+    std::unique_ptr<DataBlockCollection> createFlatTupleBlockCollection() const;
     std::vector<BlockAppendingInfo> allocateFlatTupleBlocks(uint64_t numTuplesToAppend);
     uint8_t* allocateUnflatTupleBlock(uint32_t numBytes);
     void copyFlatVectorToFlatColumn(const common::ValueVector& vector,
@@ -301,9 +360,20 @@ private:
     common::overflow_value_t appendVectorToUnflatTupleBlocks(
         const common::ValueVector& vector, ft_col_idx_t colIdx);
 
+    void scanColumnar(std::vector<common::ValueVector*>& vectors, ft_tuple_idx_t tupleIdx,
+        uint64_t numTuplesToScan, std::vector<ft_col_idx_t>& colIdxesToScan) const;
+    void readFlatColumnToUnflatVector(ft_tuple_idx_t tupleIdx, uint64_t numTuplesToRead,
+        ft_col_idx_t colIdx, common::ValueVector& vector) const;
+
     // TODO(Guodong): Unify these two `readUnflatCol()` with a (possibly templated) copy executor.
-    void readUnflatCol(
-        uint8_t** tuplesToRead, ft_col_idx_t colIdx, common::ValueVector& vector) const;
+    inline void readUnflatCol(
+        uint8_t** tuplesToRead, ft_col_idx_t colIdx, common::ValueVector& vector) const {
+        readUnflatCol(
+            *(common::overflow_value_t*)(tuplesToRead[0] + tableSchema->getColOffset(colIdx)),
+            colIdx, vector);
+    }
+    void readUnflatCol(const common::overflow_value_t& vectorOverflowValue, ft_col_idx_t colIdx,
+        common::ValueVector& vector) const;
     void readUnflatCol(const uint8_t* tupleToRead, const common::SelectionVector* selVector,
         ft_col_idx_t colIdx, common::ValueVector& vector) const;
     void readFlatColToFlatVector(
@@ -318,6 +388,12 @@ private:
     }
     static void copyOverflowIfNecessary(uint8_t* dst, uint8_t* src, const common::DataType& type,
         storage::DiskOverflowFile* diskOverflowFile);
+    // Values of other types are not stored inline (e.g. strings) or are stored in child vectors
+    // (structs), so they need to be copied one at a time.
+    static inline bool isCopiedByMemcpy(const common::DataType& type) {
+        return type.typeID != common::STRING && type.typeID != common::VAR_LIST &&
+               type.typeID != common::STRUCT;
+    }
 
 private:
     storage::MemoryManager* memoryManager;
@@ -353,9 +429,12 @@ private:
         values[colIdx]->copyValueFrom(valueBuffer);
     }
 
-    void readUnflatColToFlatTuple(ft_col_idx_t colIdx, uint8_t* valueBuffer);
+    void readUnflatColToFlatTuple(ft_col_idx_t colIdx);
+
+    void readFlatColToFlatTuple(ft_col_idx_t colIdx);
 
-    void readFlatColToFlatTuple(ft_col_idx_t colIdx, uint8_t* valueBuffer);
+    // Caches the addresses of the cells and the null map of the tuple to iterate.
+    void updateCurrentTuple(ft_tuple_idx_t tupleIdx);
 
     // We put pair(UINT64_MAX, UINT64_MAX) in all invalid entries in
     // FlatTuplePositionsInDataChunk.
@@ -376,7 +455,8 @@ private:
     void updateFlatTuplePositionsInDataChunk();
 
     FactorizedTable& factorizedTable;
-    uint8_t* currentTupleBuffer;
+    std::vector<uint8_t*> currentTupleCells;
+    uint8_t* currentTupleNullMap;
     uint64_t numFlatTuples;
     ft_tuple_idx_t nextFlatTupleIdx;
     ft_tuple_idx_t nextTupleIdx;
@@ -204,6 +204,8 @@ private:
     void cachePageIntoFrame(
         BMFileHandle& fileHandle, common::page_idx_t pageIdx, PageReadPolicy pageReadPolicy);
     void flushIfDirtyWithoutLock(BMFileHandle& fileHandle, common::page_idx_t pageIdx);
+    void flushPagesAndRemoveFromFramesWithoutLock(
+        BMFileHandle& fileHandle, common::page_idx_t startPageIdx, uint64_t numPages);
     void removePageFromFrame(
         BMFileHandle& fileHandle, common::page_idx_t pageIdx, bool shouldFlush);
 
@@ -67,15 +67,13 @@ public:
     static insert_function_t initializeInsertFunc(common::DataTypeID dataTypeID);
 
     // HashFunc
+    // Slots of the hash index are persisted, so the index keeps its own hash functions instead of
+    // following changes to the hash functions of in-memory hash tables.
     inline static common::hash_t hashFuncForInt64(const uint8_t* key) {
-        common::hash_t hash;
-        function::operation::Hash::operation(*(int64_t*)key, hash);
-        return hash;
+        return *(uint64_t*)key * UINT64_C(0xbf58476d1ce4e5b9);
     }
     inline static common::hash_t hashFuncForString(const uint8_t* key) {
-        common::hash_t hash;
-        function::operation::Hash::operation(std::string((char*)key), hash);
-        return hash;
+        return std::hash<std::string_view>()(std::string_view((char*)key));
     }
     static hash_function_t initializeHashFunc(common::DataTypeID dataTypeID);
 
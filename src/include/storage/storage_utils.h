@@ -255,6 +255,8 @@ public:
 
     static std::unique_ptr<common::FileInfo> getFileInfoForReadWrite(
         const std::string& directory, StorageStructureID storageStructureID);
+    static std::string getStorageStructureFName(
+        const std::string& directory, StorageStructureID storageStructureID);
 
     static std::string getColumnFName(
         const std::string& directory, StorageStructureID storageStructureID);
@@ -1,6 +1,7 @@
 #pragma once
 
 #include "catalog/catalog.h"
+#include "common/task_system/task_scheduler.h"
 #include "storage/buffer_manager/buffer_manager.h"
 #include "storage/wal/wal.h"
 #include "storage/wal/wal_record.h"
@@ -20,7 +21,8 @@ public:
     // This interface is used for recovery only. We always recover the disk files before
     // constructing the storageManager and catalog. So this specialized recovery constructor
     // doesn't take in storageManager and bufferManager.
-    explicit WALReplayer(WAL* wal);
+    // If a taskScheduler is given, pages of different files are copied back in parallel.
+    explicit WALReplayer(WAL* wal, common::TaskScheduler* taskScheduler = nullptr);
 
     WALReplayer(WAL* wal, StorageManager* storageManager, MemoryManager* memoryManager,
         catalog::Catalog* catalog, bool isCheckpoint);
@@ -30,8 +32,13 @@ public:
 private:
     void init();
     void replayWALRecord(WALRecord& walRecord);
+    void replayPageUpdateOrInsertRecords();
+    void checkpointPageUpdateOrInsertRecordsOfFile(const std::string& fName,
+        std::vector<PageUpdateOrInsertRecord>& records, uint8_t* buffer);
+    void readWALPagesIntoBuffer(
+        const PageUpdateOrInsertRecord* records, uint64_t numRecords, uint8_t* buffer);
     void checkpointOrRollbackVersionedFileHandleAndBufferManager(
-        const WALRecord& walRecord, const StorageStructureID& storageStructureID);
+        const PageUpdateOrInsertRecord& pageInsertOrUpdateRecord, uint8_t* walPage);
     void truncateFileIfInsertion(
         BMFileHandle* fileHandle, const PageUpdateOrInsertRecord& pageInsertOrUpdateRecord);
     BMFileHandle* getVersionedFileHandleIfWALVersionAndBMShouldBeCleared(
@@ -47,10 +54,15 @@ private:
     BufferManager* bufferManager;
     MemoryManager* memoryManager;
     std::shared_ptr<BMFileHandle> walFileHandle;
+    // Holds up to MAX_NUM_PAGES_PER_CHECKPOINT_WRITE WAL pages that are written back together.
     std::unique_ptr<uint8_t[]> pageBuffer;
+    // PAGE_UPDATE_OR_INSERT_RECORDs are not replayed one by one. We buffer consecutive ones and
+    // replay them per file in page order, so that adjacent pages are copied with a single write.
+    std::vector<PageUpdateOrInsertRecord> pageUpdateOrInsertRecordsToReplay;
     std::shared_ptr<spdlog::logger> logger;
     WAL* wal;
     catalog::Catalog* catalog;
+    common::TaskScheduler* taskScheduler;
 };
 
 } // namespace storage
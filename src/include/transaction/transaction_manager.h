@@ -1,5 +1,6 @@
 #pragma once
 
+#include <condition_variable>
 #include <memory>
 #include <mutex>
 #include <unordered_set>
@@ -20,7 +21,9 @@ public:
         : logger{common::LoggerUtils::getLogger(
               common::LoggerConstants::LoggerEnum::TRANSACTION_MANAGER)},
           wal{wal}, activeWriteTransactionID{INT64_MAX}, lastTransactionID{0}, lastCommitID{0} {};
-    std::unique_ptr<Transaction> beginWriteTransaction();
+    // If another write transaction is active, waits up to waitTimeoutInMicros for it to commit or
+    // roll back before throwing. The default of zero throws immediately.
+    std::unique_ptr<Transaction> beginWriteTransaction(uint64_t waitTimeoutInMicros = 0);
     std::unique_ptr<Transaction> beginReadOnlyTransaction();
     void commit(Transaction* transaction);
     void commitButKeepActiveWriteTransaction(Transaction* transaction);
@@ -54,6 +57,7 @@ private:
     inline void clearActiveWriteTransactionIfWriteTransactionNoLock(Transaction* transaction) {
         if (transaction->isWriteTransaction()) {
             activeWriteTransactionID = INT64_MAX;
+            cvForActiveWriteTransactionToLeave.notify_all();
         }
     }
     void commitOrRollbackNoLock(Transaction* transaction, bool isCommit);
@@ -82,6 +86,12 @@ private:
     // function, which needs to let calls to comming and rollback.
     std::mutex mtxForSerializingPublicFunctionCalls;
     std::mutex mtxForStartingNewTransactions;
+    // Notified when the last active read-only transaction leaves the system, so that a committing
+    // write transaction does not need to poll for read-only transactions to leave.
+    std::condition_variable cvForReadOnlyTransactionsToLeave;
+    // Notified when the active write transaction leaves the system, so that write transactions
+    // waiting to begin can be admitted one after another.
+    std::condition_variable cvForActiveWriteTransactionToLeave;
     uint64_t checkPointWaitTimeoutForTransactionsToLeaveInMicros =
         common::DEFAULT_CHECKPOINT_WAIT_TIMEOUT_FOR_TRANSACTIONS_TO_LEAVE_IN_MICROS;
 };
@@ -11,7 +11,12 @@ ActiveQuery::ActiveQuery() : interrupted{false} {}
 
 ClientContext::ClientContext()
     : numThreadsForExecution{std::thread::hardware_concurrency()},
-      timeoutInMS{common::ClientContextConstants::TIMEOUT_IN_MS} {}
+      timeoutInMS{common::ClientContextConstants::TIMEOUT_IN_MS},
+      writeTransactionWaitTimeoutInMS{
+          common::ClientContextConstants::WRITE_TRANSACTION_WAIT_TIMEOUT_IN_MS},
+      orderByStringKeyPrefixLength{
+          common::ClientContextConstants::ORDER_BY_STRING_KEY_PREFIX_LENGTH},
+      queryPriority{common::ClientContextConstants::QUERY_PRIORITY} {}
 
 void ClientContext::startTimingIfEnabled() {
     if (isTimeOutEnabled()) {
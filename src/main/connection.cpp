@@ -3,6 +3,7 @@
 #include "binder/binder.h"
 #include "json.hpp"
 #include "main/database.h"
+#include "main/plan_cache.h"
 #include "main/plan_printer.h"
 #include "optimizer/optimizer.h"
 #include "parser/parser.h"
@@ -154,21 +155,53 @@ std::unique_ptr<PreparedStatement> Connection::prepareNoLock(
     }
     auto compilingTimer = TimeMetric(true /* enable */);
     compilingTimer.start();
+    // Only the best plan of a query is cached, so enumerating plans always compiles from scratch.
+    auto usePlanCache = !enumerateAllPlans && encodedJoin.empty();
+    std::string normalizedQuery;
+    uint64_t planCacheVersion;
+    if (usePlanCache) {
+        normalizedQuery = PlanCache::normalizeQuery(query);
+        planCacheVersion = database->planCache->getVersion();
+        auto cachedPlan = database->planCache->get(normalizedQuery);
+        if (cachedPlan != nullptr) {
+            preparedStatement->statementType = cachedPlan->statementType;
+            preparedStatement->readOnly = cachedPlan->readOnly;
+            preparedStatement->preparedSummary.isExplain = cachedPlan->isExplain;
+            preparedStatement->preparedSummary.isProfile = cachedPlan->isProfile;
+            // Each prepared statement binds its own parameter values.
+            for (auto& [name, value] : cachedPlan->parameterMap) {
+                preparedStatement->parameterMap.insert({name, std::make_shared<Value>(*value)});
+            }
+            preparedStatement->statementResult = cachedPlan->statementResult->copy();
+            preparedStatement->logicalPlans.push_back(cachedPlan->logicalPlan->shallowCopy());
+            compilingTimer.stop();
+            preparedStatement->preparedSummary.compilingTime = compilingTimer.getElapsedTimeMS();
+            return preparedStatement;
+        }
+    }
     std::unique_ptr<ExecutionContext> executionContext;
     std::unique_ptr<LogicalPlan> logicalPlan;
+    auto parsingTimer = TimeMetric(true /* enable */);
+    auto bindingTimer = TimeMetric(true /* enable */);
+    auto planningTimer = TimeMetric(true /* enable */);
     try {
         // parsing
+        parsingTimer.start();
         auto statement = Parser::parseQuery(query);
+        parsingTimer.stop();
         preparedStatement->preparedSummary.isExplain = statement->isExplain();
         preparedStatement->preparedSummary.isProfile = statement->isProfile();
         // binding
+        bindingTimer.start();
         auto binder = Binder(*database->catalog);
         auto boundStatement = binder.bind(*statement);
         preparedStatement->statementType = boundStatement->getStatementType();
         preparedStatement->readOnly = boundStatement->isReadOnly();
         preparedStatement->parameterMap = binder.getParameterMap();
         preparedStatement->statementResult = boundStatement->getStatementResult()->copy();
+        bindingTimer.stop();
         // planning
+        planningTimer.start();
         auto& nodeStatistics =
             database->storageManager->getNodesStore().getNodesStatisticsAndDeletedIDs();
         auto& relStatistics = database->storageManager->getRelsStore().getRelsStatistics();
@@ -184,6 +217,7 @@ std::unique_ptr<PreparedStatement> Connection::prepareNoLock(
         for (auto& plan : plans) {
             optimizer::Optimizer::optimize(plan.get());
         }
+        planningTimer.stop();
         if (!encodedJoin.empty()) {
             std::unique_ptr<LogicalPlan> match;
             for (auto& plan : plans) {
@@ -198,12 +232,31 @@ std::unique_ptr<PreparedStatement> Connection::prepareNoLock(
         } else {
             preparedStatement->logicalPlans = std::move(plans);
         }
+        // DDL and COPY statements are executed once.
+        if (usePlanCache && preparedStatement->statementType == StatementType::QUERY) {
+            auto cachedPlan = std::make_shared<CachedPlan>();
+            cachedPlan->statementType = preparedStatement->statementType;
+            cachedPlan->readOnly = preparedStatement->readOnly;
+            cachedPlan->isExplain = preparedStatement->preparedSummary.isExplain;
+            cachedPlan->isProfile = preparedStatement->preparedSummary.isProfile;
+            // Copy the parameters so that binding values to this statement does not modify the
+            // cached ones.
+            for (auto& [name, value] : preparedStatement->parameterMap) {
+                cachedPlan->parameterMap.insert({name, std::make_shared<Value>(*value)});
+            }
+            cachedPlan->statementResult = preparedStatement->statementResult->copy();
+            cachedPlan->logicalPlan = preparedStatement->logicalPlans[0]->shallowCopy();
+            database->planCache->put(normalizedQuery, std::move(cachedPlan), planCacheVersion);
+        }
     } catch (std::exception& exception) {
         preparedStatement->success = false;
         preparedStatement->errMsg = exception.what();
     }
     compilingTimer.stop();
     preparedStatement->preparedSummary.compilingTime = compilingTimer.getElapsedTimeMS();
+    preparedStatement->preparedSummary.parsingTime = parsingTimer.getElapsedTimeMS();
+    preparedStatement->preparedSummary.bindingTime = bindingTimer.getElapsedTimeMS();
+    preparedStatement->preparedSummary.planningTime = planningTimer.getElapsedTimeMS();
     return preparedStatement;
 }
 
@@ -276,6 +329,27 @@ void Connection::setQueryTimeOut(uint64_t timeoutInMS) {
     clientContext->timeoutInMS = timeoutInMS;
 }
 
+void Connection::setWriteTransactionWaitTimeOut(uint64_t timeoutInMS) {
+    lock_t lck{mtx};
+    clientContext->writeTransactionWaitTimeoutInMS = timeoutInMS;
+}
+
+void Connection::setOrderByStringKeyPrefixLength(uint32_t prefixLength) {
+    lock_t lck{mtx};
+    if (prefixLength == 0 ||
+        prefixLength > ClientContextConstants::MAX_ORDER_BY_STRING_KEY_PREFIX_LENGTH) {
+        throw ConnectionException(
+            "The ORDER BY string key prefix length must be between 1 and " +
+            std::to_string(ClientContextConstants::MAX_ORDER_BY_STRING_KEY_PREFIX_LENGTH) + ".");
+    }
+    clientContext->orderByStringKeyPrefixLength = prefixLength;
+}
+
+void Connection::setQueryPriority(uint64_t priority) {
+    lock_t lck{mtx};
+    clientContext->queryPriority = priority;
+}
+
 std::unique_ptr<QueryResult> Connection::executeWithParams(PreparedStatement* preparedStatement,
     std::unordered_map<std::string, std::shared_ptr<Value>>& inputParams) {
     lock_t lck{mtx};
@@ -312,8 +386,8 @@ std::unique_ptr<QueryResult> Connection::executeAndAutoCommitIfNecessaryNoLock(
     PreparedStatement* preparedStatement, uint32_t planIdx) {
     clientContext->activeQuery = std::make_unique<ActiveQuery>();
     clientContext->startTimingIfEnabled();
-    auto mapper = PlanMapper(
-        *database->storageManager, database->memoryManager.get(), database->catalog.get());
+    auto mapper = PlanMapper(*database->storageManager, database->memoryManager.get(),
+        database->catalog.get(), &preparedStatement->parameterMap);
     std::unique_ptr<PhysicalPlan> physicalPlan;
     if (preparedStatement->isSuccess()) {
         try {
@@ -372,7 +446,8 @@ void Connection::beginTransactionNoLock(TransactionType type) {
     }
     activeTransaction = type == transaction::TransactionType::READ_ONLY ?
                             database->transactionManager->beginReadOnlyTransaction() :
-                            database->transactionManager->beginWriteTransaction();
+                            database->transactionManager->beginWriteTransaction(
+                                clientContext->writeTransactionWaitTimeoutInMS * 1000);
 }
 
 void Connection::commitOrRollbackNoLock(bool isCommit, bool skipCheckpointForTesting) {
@@ -3,6 +3,7 @@
 #include <utility>
 
 #include "common/logging_level_utils.h"
+#include "main/plan_cache.h"
 #include "processor/processor.h"
 #include "spdlog/spdlog.h"
 #include "storage/storage_manager.h"
@@ -41,11 +42,15 @@ Database::Database(std::string databasePath, SystemConfig systemConfig)
     bufferManager = std::make_unique<BufferManager>(this->systemConfig.bufferPoolSize);
     memoryManager = std::make_unique<MemoryManager>(bufferManager.get());
     wal = std::make_unique<WAL>(this->databasePath, *bufferManager);
-    recoverIfNecessary();
+    // The query processor is created before recovery so that its task scheduler can be used to
+    // replay the WAL in parallel.
     queryProcessor = std::make_unique<processor::QueryProcessor>(this->systemConfig.maxNumThreads);
+    recoverIfNecessary();
     catalog = std::make_unique<catalog::Catalog>(wal.get());
     storageManager = std::make_unique<storage::StorageManager>(*catalog, *memoryManager, wal.get());
     transactionManager = std::make_unique<transaction::TransactionManager>(*wal);
+    planCache = std::make_unique<PlanCache>(ClientContextConstants::PLAN_CACHE_CAPACITY);
+    numTuplesPerTableForPlanCache = getNumTuplesPerTable();
 }
 
 Database::~Database() {
@@ -53,6 +58,14 @@ Database::~Database() {
     bufferManager->clearEvictionQueue();
 }
 
+uint64_t Database::getNumPlanCacheHits() const {
+    return planCache->getNumHits();
+}
+
+uint64_t Database::getNumPlanCacheMisses() const {
+    return planCache->getNumMisses();
+}
+
 void Database::initDBDirAndCoreFilesIfNecessary() const {
     if (!FileUtils::fileOrPathExists(databasePath)) {
         FileUtils::createDir(databasePath);
@@ -129,7 +142,8 @@ void Database::commitAndCheckpointOrRollback(
             }
         }
     }
-    if (catalog->hasUpdates()) {
+    bool catalogHasUpdates = catalog->hasUpdates();
+    if (catalogHasUpdates) {
         wal->logCatalogRecord();
         // If we are committing, we also need to write the WAL file for catalog.
         if (isCommit) {
@@ -156,6 +170,16 @@ void Database::commitAndCheckpointOrRollback(
             return;
         }
         checkpointAndClearWAL();
+        // Cached plans are compiled against the catalog and table statistics, which have just
+        // been replaced by the checkpoint. Plans stay valid unless the catalog changed or the
+        // tables changed size materially.
+        if (catalogHasUpdates || nodeTableHasUpdates || relTableHasUpdates) {
+            auto numTuplesPerTable = getNumTuplesPerTable();
+            if (catalogHasUpdates || haveStatisticsChangedForPlanCache(numTuplesPerTable)) {
+                planCache->invalidate();
+                numTuplesPerTableForPlanCache = std::move(numTuplesPerTable);
+            }
+        }
     } else {
         if (skipCheckpointForTestingRecovery) {
             wal->flushAllPages();
@@ -169,6 +193,38 @@ void Database::commitAndCheckpointOrRollback(
     }
 }
 
+std::unordered_map<table_id_t, uint64_t> Database::getNumTuplesPerTable() const {
+    std::unordered_map<table_id_t, uint64_t> numTuplesPerTable;
+    auto& nodesStatistics = storageManager->getNodesStore().getNodesStatisticsAndDeletedIDs();
+    for (auto& [tableID, statistics] :
+        nodesStatistics.getReadOnlyVersion()->tableStatisticPerTable) {
+        numTuplesPerTable.insert({tableID, statistics->getNumTuples()});
+    }
+    auto& relsStatistics = storageManager->getRelsStore().getRelsStatistics();
+    for (auto& [tableID, statistics] :
+        relsStatistics.getReadOnlyVersion()->tableStatisticPerTable) {
+        numTuplesPerTable.insert({tableID, statistics->getNumTuples()});
+    }
+    return numTuplesPerTable;
+}
+
+bool Database::haveStatisticsChangedForPlanCache(
+    const std::unordered_map<table_id_t, uint64_t>& numTuplesPerTable) const {
+    auto ratio = ClientContextConstants::PLAN_CACHE_STATISTICS_CHANGE_RATIO;
+    for (auto& [tableID, numTuples] : numTuplesPerTable) {
+        // Empty tables are treated as tables with a single tuple to avoid division by zero.
+        auto prevNumTuples = numTuplesPerTableForPlanCache.contains(tableID) ?
+                                 numTuplesPerTableForPlanCache.at(tableID) :
+                                 0;
+        auto curNumTuples = (double)std::max<uint64_t>(numTuples, 1);
+        auto cachedNumTuples = (double)std::max<uint64_t>(prevNumTuples, 1);
+        if (curNumTuples > cachedNumTuples * ratio || cachedNumTuples > curNumTuples * ratio) {
+            return true;
+        }
+    }
+    return false;
+}
+
 void Database::checkpointAndClearWAL() {
     checkpointOrRollbackAndClearWAL(false /* is not recovering */, true /* isCheckpoint */);
 }
@@ -198,9 +254,10 @@ void Database::checkpointOrRollbackAndClearWAL(bool isRecovering, bool isCheckpo
                                  std::string("rolling back the wal contents")) +
                  " in the storage manager during " +
                  (isRecovering ? "recovery." : "normal db execution (i.e., not recovering)."));
-    WALReplayer walReplayer = isRecovering ? WALReplayer(wal.get()) :
-                                             WALReplayer(wal.get(), storageManager.get(),
-                                                 memoryManager.get(), catalog.get(), isCheckpoint);
+    WALReplayer walReplayer =
+        isRecovering ? WALReplayer(wal.get(), queryProcessor->getTaskScheduler()) :
+                       WALReplayer(wal.get(), storageManager.get(), memoryManager.get(),
+                           catalog.get(), isCheckpoint);
     walReplayer.replay();
     logger->info("Finished " +
                  (isCheckpoint ? std::string("checkpointing") :
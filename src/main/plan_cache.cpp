@@ -0,0 +1,74 @@
+#include "main/plan_cache.h"
+
+namespace kuzu {
+namespace main {
+
+// Trims the query and collapses consecutive whitespaces outside of quoted literals and names into
+// a single space, so that queries differing only in formatting share a cache entry.
+std::string PlanCache::normalizeQuery(const std::string& query) {
+    std::string result;
+    result.reserve(query.size());
+    char quote = 0;
+    bool pendingSpace = false;
+    for (auto i = 0u; i < query.size(); ++i) {
+        auto c = query[i];
+        if (quote != 0) {
+            result += c;
+            if (c == '\\' && i + 1 < query.size()) {
+                result += query[++i];
+            } else if (c == quote) {
+                quote = 0;
+            }
+            continue;
+        }
+        if (isspace(c)) {
+            pendingSpace = !result.empty();
+            continue;
+        }
+        if (pendingSpace) {
+            result += ' ';
+            pendingSpace = false;
+        }
+        if (c == '\'' || c == '"' || c == '`') {
+            quote = c;
+        }
+        result += c;
+    }
+    return result;
+}
+
+std::shared_ptr<CachedPlan> PlanCache::get(const std::string& normalizedQuery) {
+    std::lock_guard<std::mutex> lck{mtx};
+    auto it = queryToPlan.find(normalizedQuery);
+    if (it == queryToPlan.end()) {
+        numMisses++;
+        return nullptr;
+    }
+    numHits++;
+    plans.splice(plans.begin(), plans, it->second);
+    return it->second->second;
+}
+
+void PlanCache::put(const std::string& normalizedQuery, std::shared_ptr<CachedPlan> plan,
+    uint64_t versionAtCompile) {
+    std::lock_guard<std::mutex> lck{mtx};
+    if (capacity == 0 || versionAtCompile != version || queryToPlan.contains(normalizedQuery)) {
+        return;
+    }
+    plans.emplace_front(normalizedQuery, std::move(plan));
+    queryToPlan.insert({normalizedQuery, plans.begin()});
+    if (plans.size() > capacity) {
+        queryToPlan.erase(plans.back().first);
+        plans.pop_back();
+    }
+}
+
+void PlanCache::invalidate() {
+    std::lock_guard<std::mutex> lck{mtx};
+    version++;
+    plans.clear();
+    queryToPlan.clear();
+}
+
+} // namespace main
+} // namespace kuzu
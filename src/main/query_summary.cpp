@@ -9,6 +9,18 @@ double QuerySummary::getCompilingTime() const {
     return preparedSummary.compilingTime;
 }
 
+double QuerySummary::getParsingTime() const {
+    return preparedSummary.parsingTime;
+}
+
+double QuerySummary::getBindingTime() const {
+    return preparedSummary.bindingTime;
+}
+
+double QuerySummary::getPlanningTime() const {
+    return preparedSummary.planningTime;
+}
+
 double QuerySummary::getExecutionTime() const {
     return executionTime;
 }
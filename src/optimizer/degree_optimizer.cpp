@@ -0,0 +1,48 @@
+#include "optimizer/degree_optimizer.h"
+
+#include "planner/logical_plan/logical_operator/logical_extend.h"
+#include "planner/logical_plan/logical_operator/logical_projection.h"
+#include "planner/logical_plan/logical_operator/logical_scan_node_property.h"
+
+using namespace kuzu::planner;
+
+namespace kuzu {
+namespace optimizer {
+
+void DegreeOptimizer::rewrite(planner::LogicalPlan* plan) {
+    visitOperator(plan->getLastOperator().get());
+}
+
+void DegreeOptimizer::visitOperator(planner::LogicalOperator* op) {
+    visitOperatorSwitch(op);
+    for (auto i = 0u; i < op->getNumChildren(); ++i) {
+        visitOperator(op->getChild(i).get());
+    }
+}
+
+void DegreeOptimizer::visitProjection(planner::LogicalOperator* op) {
+    auto projection = (LogicalProjection*)op;
+    auto child = projection->getChild(0).get();
+    // Property scans of other nodes do not change the number of tuples, so we look through them.
+    std::unordered_set<std::string> scannedNodeNames;
+    while (child->getOperatorType() == LogicalOperatorType::SCAN_NODE_PROPERTY) {
+        scannedNodeNames.insert(((LogicalScanNodeProperty*)child)->getNode()->getUniqueName());
+        child = child->getChild(0).get();
+    }
+    if (child->getOperatorType() != LogicalOperatorType::EXTEND) {
+        return;
+    }
+    auto extend = (LogicalExtend*)child;
+    if (!extend->getProperties().empty() ||
+        scannedNodeNames.contains(extend->getNbrNode()->getUniqueName())) {
+        return;
+    }
+    auto nbrNodeID = extend->getNbrNode()->getInternalIDProperty();
+    auto nbrGroupPos = projection->getChild(0)->getSchema()->getGroupPos(*nbrNodeID);
+    if (projection->getDiscardedGroupsPos().contains(nbrGroupPos)) {
+        extend->setCountNbrsOnly();
+    }
+}
+
+} // namespace optimizer
+} // namespace kuzu
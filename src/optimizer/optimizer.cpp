@@ -1,6 +1,7 @@
 #include "optimizer/optimizer.h"
 
 #include "optimizer/acc_hash_join_optimizer.h"
+#include "optimizer/degree_optimizer.h"
 #include "optimizer/factorization_rewriter.h"
 #include "optimizer/filter_push_down_optimizer.h"
 #include "optimizer/projection_push_down_optimizer.h"
@@ -30,6 +31,11 @@ void Optimizer::optimize(planner::LogicalPlan* plan) {
 
     auto factorizationRewriter = FactorizationRewriter();
     factorizationRewriter.rewrite(plan);
+
+    // Degree optimizer relies on the discarded groups of projections, which are only known after
+    // the factorization structure is computed.
+    auto degreeOptimizer = DegreeOptimizer();
+    degreeOptimizer.rewrite(plan);
 }
 
 } // namespace optimizer
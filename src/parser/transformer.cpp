@@ -53,12 +53,27 @@ std::unique_ptr<RegularQuery> Transformer::transformQuery(CypherParser::OC_Query
     return transformRegularQuery(*ctx.oC_RegularQuery());
 }
 
+// getText() concatenates tokens without the whitespace between them, so different queries may have
+// the same text. We compare single queries by their original text in the input instead.
+static std::string getOriginalText(antlr4::ParserRuleContext& ctx) {
+    return ctx.start->getInputStream()->getText(
+        antlr4::misc::Interval(ctx.start->getStartIndex(), ctx.stop->getStopIndex()));
+}
+
 std::unique_ptr<RegularQuery> Transformer::transformRegularQuery(
     CypherParser::OC_RegularQueryContext& ctx) {
     auto regularQuery = std::make_unique<RegularQuery>(transformSingleQuery(*ctx.oC_SingleQuery()));
+    // Textually identical single queries have identical results. We record them so that the planner
+    // can evaluate each of them only once.
+    std::vector<std::string> singleQueryTexts{getOriginalText(*ctx.oC_SingleQuery())};
     for (auto unionClause : ctx.oC_Union()) {
-        regularQuery->addSingleQuery(
-            transformSingleQuery(*unionClause->oC_SingleQuery()), unionClause->ALL());
+        auto singleQueryText = getOriginalText(*unionClause->oC_SingleQuery());
+        auto identicalSingleQueryIdx =
+            std::find(singleQueryTexts.begin(), singleQueryTexts.end(), singleQueryText) -
+            singleQueryTexts.begin();
+        singleQueryTexts.push_back(std::move(singleQueryText));
+        regularQuery->addSingleQuery(transformSingleQuery(*unionClause->oC_SingleQuery()),
+            unionClause->ALL(), identicalSingleQueryIdx);
     }
     return regularQuery;
 }
@@ -22,7 +22,7 @@ uint64_t CardinalityEstimator::estimateScanNode(LogicalOperator* op) {
 
 // Although we may not flatten join key in Build operator computation. We do need to calculate join
 // cardinality based on flat join key cardinality.
-static uint64_t getJoinKeysFlatCardinality(
+static double getJoinKeysFlatCardinality(
     const binder::expression_vector& joinNodeIDs, const LogicalPlan& buildPlan) {
     auto schema = buildPlan.getSchema();
     f_group_pos_set unFlatGroupsPos;
@@ -32,7 +32,7 @@ static uint64_t getJoinKeysFlatCardinality(
             unFlatGroupsPos.insert(groupPos);
         }
     }
-    auto cardinality = buildPlan.getCardinality();
+    double cardinality = buildPlan.getCardinality();
     for (auto groupPos : unFlatGroupsPos) {
         cardinality *= schema->getGroup(groupPos)->getMultiplier();
     }
@@ -41,42 +41,43 @@ static uint64_t getJoinKeysFlatCardinality(
 
 uint64_t CardinalityEstimator::estimateHashJoin(const binder::expression_vector& joinNodeIDs,
     const LogicalPlan& probePlan, const LogicalPlan& buildPlan) {
-    auto denominator = 1u;
+    // Use double to avoid overflow when multiplying domains and cardinalities of large tables.
+    double denominator = 1;
     for (auto& joinNodeID : joinNodeIDs) {
         denominator *= getNodeIDDom(joinNodeID->getUniqueName());
     }
-    return atLeastOne(probePlan.estCardinality *
+    return atLeastOne((double)probePlan.estCardinality *
                       getJoinKeysFlatCardinality(joinNodeIDs, buildPlan) / denominator);
 }
 
 uint64_t CardinalityEstimator::estimateCrossProduct(
     const LogicalPlan& probePlan, const LogicalPlan& buildPlan) {
-    return atLeastOne(probePlan.estCardinality * buildPlan.estCardinality);
+    return atLeastOne((double)probePlan.estCardinality * (double)buildPlan.estCardinality);
 }
 
 uint64_t CardinalityEstimator::estimateIntersect(const binder::expression_vector& joinNodeIDs,
     const LogicalPlan& probePlan, const std::vector<std::unique_ptr<LogicalPlan>>& buildPlans) {
     // Formula 1: treat intersect as a Filter on probe side.
-    uint64_t estCardinality1 =
+    double estCardinality1 =
         probePlan.estCardinality * common::PlannerKnobs::NON_EQUALITY_PREDICATE_SELECTIVITY;
     // Formula 2: assume independence on join conditions.
-    auto denominator = 1u;
+    double denominator = 1;
     for (auto& joinNodeID : joinNodeIDs) {
         denominator *= getNodeIDDom(joinNodeID->getUniqueName());
     }
-    auto numerator = probePlan.estCardinality;
+    double numerator = probePlan.estCardinality;
     for (auto& buildPlan : buildPlans) {
         numerator *= buildPlan->estCardinality;
     }
     auto estCardinality2 = numerator / denominator;
     // Pick minimum between the two formulas.
-    return atLeastOne(std::min<uint64_t>(estCardinality1, estCardinality2));
+    return atLeastOne(std::min<double>(estCardinality1, estCardinality2));
 }
 
 uint64_t CardinalityEstimator::estimateFlatten(
     const LogicalPlan& childPlan, f_group_pos groupPosToFlatten) {
     auto group = childPlan.getSchema()->getGroup(groupPosToFlatten);
-    return atLeastOne(childPlan.estCardinality * group->cardinalityMultiplier);
+    return atLeastOne((double)childPlan.estCardinality * group->cardinalityMultiplier);
 }
 
 static bool isPrimaryKey(const binder::Expression& expression) {
@@ -88,39 +89,95 @@ static bool isPrimaryKey(const binder::Expression& expression) {
 
 uint64_t CardinalityEstimator::estimateFilter(
     const LogicalPlan& childPlan, const binder::Expression& predicate) {
-    if (predicate.expressionType == common::EQUALS) {
-        if (isPrimaryKey(*predicate.getChild(0)) || isPrimaryKey(*predicate.getChild(1))) {
-            return 1;
-        } else {
-            return atLeastOne(
-                childPlan.estCardinality * common::PlannerKnobs::EQUALITY_PREDICATE_SELECTIVITY);
+    if (predicate.expressionType == common::EQUALS &&
+        (isPrimaryKey(*predicate.getChild(0)) || isPrimaryKey(*predicate.getChild(1)))) {
+        return 1;
+    }
+    return atLeastOne((double)childPlan.estCardinality * getPredicateSelectivity(predicate));
+}
+
+// Combine selectivity of boolean connectives assuming independence between their operands so that
+// a conjunction is more selective than any of its children and a disjunction is less selective.
+double CardinalityEstimator::getPredicateSelectivity(const binder::Expression& predicate) {
+    switch (predicate.expressionType) {
+    case common::AND: {
+        return getPredicateSelectivity(*predicate.getChild(0)) *
+               getPredicateSelectivity(*predicate.getChild(1));
+    }
+    case common::OR: {
+        auto left = getPredicateSelectivity(*predicate.getChild(0));
+        auto right = getPredicateSelectivity(*predicate.getChild(1));
+        return left + right - left * right;
+    }
+    case common::NOT: {
+        return 1 - getPredicateSelectivity(*predicate.getChild(0));
+    }
+    case common::EQUALS: {
+        for (auto& child : predicate.getChildren()) {
+            if (isPrimaryKey(*child)) {
+                // A primary key equality matches a single node of the key's table.
+                return getPrimaryKeySelectivity((binder::PropertyExpression&)*child);
+            }
         }
-    } else {
-        return atLeastOne(
-            childPlan.estCardinality * common::PlannerKnobs::NON_EQUALITY_PREDICATE_SELECTIVITY);
+        return common::PlannerKnobs::EQUALITY_PREDICATE_SELECTIVITY;
+    }
+    case common::IS_NULL: {
+        return common::PlannerKnobs::EQUALITY_PREDICATE_SELECTIVITY;
+    }
+    case common::IS_NOT_NULL: {
+        return 1 - common::PlannerKnobs::EQUALITY_PREDICATE_SELECTIVITY;
     }
+    default:
+        return common::PlannerKnobs::NON_EQUALITY_PREDICATE_SELECTIVITY;
+    }
+}
+
+double CardinalityEstimator::getPrimaryKeySelectivity(const binder::PropertyExpression& property) {
+    auto nodeIDName = property.getVariableName() + "." + common::INTERNAL_ID_SUFFIX;
+    if (!nodeIDName2dom.contains(nodeIDName)) {
+        return common::PlannerKnobs::EQUALITY_PREDICATE_SELECTIVITY;
+    }
+    return 1.0 / (double)getNodeIDDom(nodeIDName);
 }
 
 uint64_t CardinalityEstimator::getNumNodes(const binder::NodeExpression& node) {
-    auto numNodes = 0u;
+    uint64_t numNodes = 0;
     for (auto& tableID : node.getTableIDs()) {
         numNodes += nodesStatistics.getNodeStatisticsAndDeletedIDs(tableID)->getNumTuples();
     }
     return atLeastOne(numNodes);
 }
 
-uint64_t CardinalityEstimator::getNumRels(const binder::RelExpression& rel) {
-    auto numRels = 0u;
+double CardinalityEstimator::getNumRelsFromBoundNode(
+    const binder::RelExpression& rel, const binder::NodeExpression& boundNode) {
+    auto direction = rel.getSrcNodeName() == boundNode.getUniqueName() ?
+                         common::RelDirection::FWD :
+                         common::RelDirection::BWD;
+    auto boundTableIDs = boundNode.getTableIDs();
+    auto catalogContent = catalog.getReadOnlyVersion();
+    double numRels = 0;
     for (auto tableID : rel.getTableIDs()) {
-        numRels += relsStatistics.getRelStatistics(tableID)->getNumTuples();
+        auto relTableSchema = catalogContent->getRelTableSchema(tableID);
+        auto boundTableID = relTableSchema->getBoundTableID(direction);
+        if (std::find(boundTableIDs.begin(), boundTableIDs.end(), boundTableID) ==
+            boundTableIDs.end()) {
+            continue;
+        }
+        auto numRelsInTable = relsStatistics.getRelStatistics(tableID)->getNumTuples();
+        if (relTableSchema->isSingleMultiplicityInDirection(direction)) {
+            // Each bound node has at most one neighbour in this table.
+            numRelsInTable = std::min<uint64_t>(numRelsInTable,
+                nodesStatistics.getNodeStatisticsAndDeletedIDs(boundTableID)->getNumTuples());
+        }
+        numRels += numRelsInTable;
     }
-    return atLeastOne(numRels);
+    return numRels == 0 ? 1 : numRels;
 }
 
 double CardinalityEstimator::getExtensionRate(
     const binder::RelExpression& rel, const binder::NodeExpression& boundNode) {
     auto numBoundNodes = (double)getNumNodes(boundNode);
-    auto numRels = (double)getNumRels(rel);
+    auto numRels = getNumRelsFromBoundNode(rel, boundNode);
     auto oneHopExtensionRate = numRels / numBoundNodes;
     switch (rel.getRelType()) {
     case common::QueryRelType::NON_RECURSIVE: {
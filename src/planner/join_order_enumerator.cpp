@@ -97,7 +97,7 @@ void JoinOrderEnumerator::exitSubquery(std::unique_ptr<JoinOrderEnumeratorContex
 
 void JoinOrderEnumerator::planLevel(uint32_t level) {
     assert(level > 1);
-    if (level > MAX_LEVEL_TO_PLAN_EXACTLY) {
+    if (level > MAX_LEVEL_TO_PLAN_EXACTLY || context->isExactEnumerationBudgetExceeded()) {
         planLevelApproximately(level);
     } else {
         planLevelExactly(level);
@@ -316,7 +316,7 @@ void JoinOrderEnumerator::planWCOJoin(const SubqueryGraph& subgraph,
         for (auto& predicate : predicates) {
             queryPlanner->appendFilter(predicate, *leftPlanCopy);
         }
-        context->subPlansTable->addPlan(newSubgraph, std::move(leftPlanCopy));
+        context->addPlan(newSubgraph, std::move(leftPlanCopy));
     }
 }
 
@@ -573,6 +573,13 @@ void JoinOrderEnumerator::appendMarkJoin(const expression_vector& joinNodeIDs,
     queryPlanner->appendFlattens(hashJoin->getGroupsPosToFlattenOnBuildSide(), buildPlan);
     hashJoin->setChild(1, buildPlan.getLastOperator());
     hashJoin->computeFactorizedSchema();
+    // The build side of a mark join scans all nodes that are correlated with the outer query.
+    // Semi-masking those scans with the outer (probe side) node IDs pays off only if the probe side
+    // is small compared to the build side. Otherwise, we simply probe the hash table.
+    auto ratio = probePlan.getCardinality() / buildPlan.getCardinality();
+    if (ratio > common::PlannerKnobs::ACC_HJ_PROBE_BUILD_RATIO) {
+        hashJoin->setSIP(SidewaysInfoPassing::PROHIBIT_PROBE_TO_BUILD);
+    }
     // update cost. Mark join does not change cardinality.
     probePlan.setCost(CostModel::computeMarkJoinCost(joinNodeIDs, probePlan, buildPlan));
     probePlan.setLastOperator(std::move(hashJoin));
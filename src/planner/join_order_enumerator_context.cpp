@@ -14,6 +14,7 @@ void JoinOrderEnumeratorContext::init(
     // Restart from level 1 for new query part so that we get hashJoin based plans
     // that uses subplans coming from previous query part.See example in planRelIndexJoin().
     currentLevel = 1;
+    numEnumeratedPlans = 0;
 }
 
 SubqueryGraph JoinOrderEnumeratorContext::getFullyMatchedSubqueryGraph() const {
@@ -46,6 +46,9 @@ f_group_pos_set LogicalAggregate::getGroupsPosToFlattenForGroupBy() {
 }
 
 f_group_pos_set LogicalAggregate::getGroupsPosToFlattenForAggregate() {
+    if (!hasDistinctAggregate() && aggregateOnSameUnFlatGroup()) {
+        return f_group_pos_set{};
+    }
     if (hasDistinctAggregate() || expressionsToAggregate.size() > 1) {
         f_group_pos_set dependentGroupsPos;
         for (auto& expression : expressionsToAggregate) {
@@ -71,6 +74,32 @@ std::string LogicalAggregate::getExpressionsForPrinting() const {
     return result;
 }
 
+// All aggregates are updated with the same multiplicity, so an aggregate that does not read an
+// unflat group would miss the size of that group if another aggregate reads it. If every aggregate
+// reads the same single unflat group, each of them iterates the group and no flattening is needed,
+// e.g., MATCH (a)-[:knows]->(b) RETURN a.ID, COUNT(b.age), SUM(b.age) aggregates b per a.
+bool LogicalAggregate::aggregateOnSameUnFlatGroup() {
+    auto schema = children[0]->getSchema();
+    auto unFlatGroupPos = INVALID_F_GROUP_POS;
+    for (auto& expression : expressionsToAggregate) {
+        f_group_pos_set unFlatGroupsPos;
+        for (auto groupPos : schema->getDependentGroupsPos(expression)) {
+            if (!schema->getGroup(groupPos)->isFlat()) {
+                unFlatGroupsPos.insert(groupPos);
+            }
+        }
+        if (unFlatGroupsPos.size() != 1) {
+            return false;
+        }
+        auto groupPos = *unFlatGroupsPos.begin();
+        if (unFlatGroupPos != INVALID_F_GROUP_POS && unFlatGroupPos != groupPos) {
+            return false;
+        }
+        unFlatGroupPos = groupPos;
+    }
+    return true;
+}
+
 bool LogicalAggregate::hasDistinctAggregate() {
     for (auto& expressionToAggregate : expressionsToAggregate) {
         auto& functionExpression = (binder::AggregateFunctionExpression&)*expressionToAggregate;
@@ -132,6 +132,12 @@ bool LogicalHashJoin::requireFlatProbeKeys() {
     if (joinType == common::JoinType::LEFT) {
         return true;
     }
+    // Mark join only checks the existence of a match, and unflat probing stops at the first match
+    // of each key. So duplicate keys on the build side do not require flattening and the whole
+    // probe side chunk is marked at once.
+    if (joinType == common::JoinType::MARK) {
+        return false;
+    }
     auto joinNodeID = joinNodeIDs[0].get();
     return !isJoinKeyUniqueOnBuildSide(*joinNodeID);
 }
@@ -53,6 +53,16 @@ void ProjectionPlanner::planProjectionBody(
     if (projectionBody.hasOrderByExpressions()) {
         planOrderBy(expressionsToProject, projectionBody.getOrderByExpressions(),
             projectionBody.getSortingOrders(), plan);
+        // DISTINCT is applied after ORDER BY and may remove tuples, so more than SKIP + LIMIT
+        // sorted tuples can be needed in that case.
+        if (projectionBody.hasLimit() && !projectionBody.getIsDistinct()) {
+            auto topN = projectionBody.getLimitNumber();
+            if (projectionBody.hasSkip()) {
+                topN += projectionBody.getSkipNumber();
+            }
+            auto orderBy = (LogicalOrderBy*)plan.getLastOperator().get();
+            orderBy->setTopN(topN);
+        }
     }
     appendProjection(expressionsToProject, plan);
     if (projectionBody.getIsDistinct()) {
@@ -24,14 +24,36 @@ std::vector<std::unique_ptr<LogicalPlan>> QueryPlanner::getAllPlans(
     if (regularQuery.getNumSingleQueries() == 1) {
         resultPlans = planSingleQuery(*regularQuery.getSingleQuery(0));
     } else {
-        std::vector<std::vector<std::unique_ptr<LogicalPlan>>> childrenLogicalPlans(
-            regularQuery.getNumSingleQueries());
+        // Identical single queries are planned once. Under UNION ALL, each duplicate reuses the
+        // plan and is marked as identical to its first occurrence so that the mapper evaluates it
+        // only once (see mapLogicalUnionAllToPhysical). Planner deep copies the final plan, so
+        // each union child still gets its own operators. Under UNION (without ALL), duplicates
+        // don't change the result and are dropped entirely.
+        auto isUnionAll = regularQuery.getIsUnionAll(0);
+        std::vector<std::vector<std::unique_ptr<LogicalPlan>>> childrenLogicalPlans;
+        std::vector<uint32_t> singleQueryIdxToPlanIdx(regularQuery.getNumSingleQueries());
+        std::vector<uint32_t> singleQueryIdxToChildIdx(regularQuery.getNumSingleQueries());
+        std::vector<uint32_t> planIdxesToUnion;
+        std::vector<uint32_t> identicalChildIdxes;
         for (auto i = 0u; i < regularQuery.getNumSingleQueries(); i++) {
-            childrenLogicalPlans[i] = planSingleQuery(*regularQuery.getSingleQuery(i));
+            auto identicalIdx = regularQuery.getIdenticalSingleQueryIdx(i);
+            if (identicalIdx == i) {
+                singleQueryIdxToPlanIdx[i] = childrenLogicalPlans.size();
+                childrenLogicalPlans.push_back(planSingleQuery(*regularQuery.getSingleQuery(i)));
+            } else if (!isUnionAll) {
+                continue;
+            }
+            singleQueryIdxToChildIdx[i] = planIdxesToUnion.size();
+            planIdxesToUnion.push_back(singleQueryIdxToPlanIdx[identicalIdx]);
+            identicalChildIdxes.push_back(singleQueryIdxToChildIdx[identicalIdx]);
         }
         auto childrenPlans = cartesianProductChildrenPlans(std::move(childrenLogicalPlans));
         for (auto& childrenPlan : childrenPlans) {
-            resultPlans.push_back(createUnionPlan(childrenPlan, regularQuery.getIsUnionAll(0)));
+            std::vector<std::unique_ptr<LogicalPlan>> plansToUnion;
+            for (auto planIdx : planIdxesToUnion) {
+                plansToUnion.push_back(childrenPlan[planIdx]->shallowCopy());
+            }
+            resultPlans.push_back(createUnionPlan(plansToUnion, identicalChildIdxes, isUnionAll));
         }
     }
     return resultPlans;
@@ -344,7 +366,8 @@ void QueryPlanner::appendScanNodePropIfNecessary(const expression_vector& proper
 }
 
 std::unique_ptr<LogicalPlan> QueryPlanner::createUnionPlan(
-    std::vector<std::unique_ptr<LogicalPlan>>& childrenPlans, bool isUnionAll) {
+    std::vector<std::unique_ptr<LogicalPlan>>& childrenPlans,
+    std::vector<uint32_t> identicalChildIdxes, bool isUnionAll) {
     assert(!childrenPlans.empty());
     auto plan = std::make_unique<LogicalPlan>();
     std::vector<std::shared_ptr<LogicalOperator>> children;
@@ -352,8 +375,8 @@ std::unique_ptr<LogicalPlan> QueryPlanner::createUnionPlan(
         children.push_back(childPlan->getLastOperator());
     }
     // we compute the schema based on first child
-    auto union_ = make_shared<LogicalUnion>(
-        childrenPlans[0]->getSchema()->getExpressionsInScope(), std::move(children));
+    auto union_ = make_shared<LogicalUnion>(childrenPlans[0]->getSchema()->getExpressionsInScope(),
+        std::move(children), std::move(identicalChildIdxes));
     for (auto i = 0u; i < childrenPlans.size(); ++i) {
         appendFlattens(union_->getGroupsPosToFlatten(i), *childrenPlans[i]);
         union_->setChild(i, childrenPlans[i]->getLastOperator());
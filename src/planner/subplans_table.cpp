@@ -16,30 +16,45 @@ SubgraphPlans::SubgraphPlans(const kuzu::binder::SubqueryGraph& subqueryGraph) {
 }
 
 void SubgraphPlans::addPlan(std::unique_ptr<LogicalPlan> plan) {
-    if (plans.size() > MAX_NUM_PLANS) {
+    auto planCode = encodePlan(*plan);
+    if (encodedPlan2PlanIdx.contains(planCode)) {
+        auto planIdx = encodedPlan2PlanIdx.at(planCode);
+        if (plan->getCost() < plans[planIdx]->getCost()) {
+            plans[planIdx] = std::move(plan);
+            updateMinMaxCost();
+        }
         return;
     }
-    auto planCode = encodePlan(*plan);
-    if (!encodedPlan2PlanIdx.contains(planCode)) {
+    if (plans.size() < MAX_NUM_PLANS) {
         encodedPlan2PlanIdx.insert({planCode, plans.size()});
-        if (maxCost == UINT64_MAX || plan->getCost() > maxCost) { // update max cost
-            maxCost = plan->getCost();
-        }
         plans.push_back(std::move(plan));
-    } else {
-        auto planIdx = encodedPlan2PlanIdx.at(planCode);
-        if (plan->getCost() < plans[planIdx]->getCost()) {
-            if (plans[planIdx]->getCost() == maxCost) { // update max cost
-                maxCost = 0;
-                for (auto& plan_ : plans) {
-                    if (plan_->getCost() > maxCost) {
-                        maxCost = plan_->getCost();
-                    }
-                }
-            }
+        updateMinMaxCost();
+        return;
+    }
+    // All slots are taken by plans with other factorization structures. Replace the most expensive
+    // one if the new plan is cheaper.
+    if (plan->getCost() >= maxCost) {
+        return;
+    }
+    for (auto it = encodedPlan2PlanIdx.begin(); it != encodedPlan2PlanIdx.end(); ++it) {
+        if (plans[it->second]->getCost() == maxCost) {
+            auto planIdx = it->second;
+            encodedPlan2PlanIdx.erase(it);
+            encodedPlan2PlanIdx.insert({planCode, planIdx});
             plans[planIdx] = std::move(plan);
+            break;
         }
     }
+    updateMinMaxCost();
+}
+
+void SubgraphPlans::updateMinMaxCost() {
+    maxCost = 0;
+    minCost = UINT64_MAX;
+    for (auto& plan : plans) {
+        maxCost = std::max(maxCost, plan->getCost());
+        minCost = std::min(minCost, plan->getCost());
+    }
 }
 
 std::bitset<MAX_NUM_QUERY_VARIABLES> SubgraphPlans::encodePlan(const LogicalPlan& plan) {
@@ -62,15 +77,43 @@ std::vector<SubqueryGraph> DPLevel::getSubqueryGraphs() {
 
 void DPLevel::addPlan(
     const kuzu::binder::SubqueryGraph& subqueryGraph, std::unique_ptr<LogicalPlan> plan) {
-    if (subgraph2Plans.size() > MAX_NUM_SUBGRAPH) {
-        return;
-    }
     if (!contains(subqueryGraph)) {
+        if (subgraph2Plans.size() >= MAX_NUM_SUBGRAPH &&
+            !evictMostExpensiveSubgraph(plan->getCost())) {
+            return;
+        }
         subgraph2Plans.insert({subqueryGraph, std::make_unique<SubgraphPlans>(subqueryGraph)});
     }
     subgraph2Plans.at(subqueryGraph)->addPlan(std::move(plan));
 }
 
+uint64_t DPLevel::getMaxCostOfNewSubgraph() const {
+    if (subgraph2Plans.size() < MAX_NUM_SUBGRAPH) {
+        return UINT64_MAX;
+    }
+    uint64_t maxCost = 0;
+    for (auto& [_, subgraphPlans] : subgraph2Plans) {
+        maxCost = std::max(maxCost, subgraphPlans->getMinCost());
+    }
+    return maxCost;
+}
+
+bool DPLevel::evictMostExpensiveSubgraph(uint64_t cost) {
+    auto subgraphToEvict = subgraph2Plans.end();
+    for (auto it = subgraph2Plans.begin(); it != subgraph2Plans.end(); ++it) {
+        if (it->second->getMinCost() > cost &&
+            (subgraphToEvict == subgraph2Plans.end() ||
+                it->second->getMinCost() > subgraphToEvict->second->getMinCost())) {
+            subgraphToEvict = it;
+        }
+    }
+    if (subgraphToEvict == subgraph2Plans.end()) {
+        return false;
+    }
+    subgraph2Plans.erase(subgraphToEvict);
+    return true;
+}
+
 void SubPlansTable::resize(uint32_t newSize) {
     auto prevSize = dpLevels.size();
     dpLevels.resize(newSize);
@@ -80,9 +123,10 @@ void SubPlansTable::resize(uint32_t newSize) {
 }
 
 uint64_t SubPlansTable::getMaxCost(const SubqueryGraph& subqueryGraph) const {
-    return containSubgraphPlans(subqueryGraph) ?
-               getDPLevel(subqueryGraph)->getSubgraphPlans(subqueryGraph)->getMaxCost() :
-               UINT64_MAX;
+    auto dpLevel = getDPLevel(subqueryGraph);
+    return dpLevel->contains(subqueryGraph) ?
+               dpLevel->getSubgraphPlans(subqueryGraph)->getMaxCost() :
+               dpLevel->getMaxCostOfNewSubgraph();
 }
 
 bool SubPlansTable::containSubgraphPlans(const SubqueryGraph& subqueryGraph) const {
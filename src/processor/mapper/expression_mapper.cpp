@@ -42,6 +42,11 @@ std::unique_ptr<evaluator::BaseExpressionEvaluator> ExpressionMapper::mapLiteral
 std::unique_ptr<evaluator::BaseExpressionEvaluator> ExpressionMapper::mapParameterExpression(
     const std::shared_ptr<binder::Expression>& expression) {
     auto& parameterExpression = (ParameterExpression&)*expression;
+    if (parameterMap != nullptr &&
+        parameterMap->contains(parameterExpression.getParameterName())) {
+        return std::make_unique<LiteralExpressionEvaluator>(
+            parameterMap->at(parameterExpression.getParameterName()));
+    }
     assert(parameterExpression.getLiteral() != nullptr);
     return std::make_unique<LiteralExpressionEvaluator>(parameterExpression.getLiteral());
 }
@@ -4,6 +4,7 @@
 #include "processor/operator/scan/generic_scan_rel_tables.h"
 #include "processor/operator/scan/scan_rel_table_columns.h"
 #include "processor/operator/scan/scan_rel_table_lists.h"
+#include "processor/operator/scan/scan_rel_table_lists_degree.h"
 #include "processor/operator/var_length_extend/var_length_adj_list_extend.h"
 #include "processor/operator/var_length_extend/var_length_column_extend.h"
 
@@ -83,6 +84,11 @@ std::unique_ptr<PhysicalOperator> PlanMapper::mapLogicalExtendToPhysical(
         } else {
             assert(!relsStore.isSingleMultiplicityInDirection(direction, relTableID));
             auto adjList = relsStore.getAdjLists(direction, relTableID);
+            if (extend->isCountNbrsOnly()) {
+                return make_unique<ScanRelTableListsDegree>(adjList, inNodeIDVectorPos,
+                    std::move(outputVectorsPos), std::move(prevOperator), getOperatorID(),
+                    extend->getExpressionsForPrinting());
+            }
             auto propertyIds = populatePropertyIds(relTableID, extend->getProperties());
             return make_unique<ScanRelTableLists>(
                 relsStore.getRelTable(relTableID)->getDirectedTableData(direction),
@@ -38,7 +38,8 @@ std::unique_ptr<PhysicalOperator> PlanMapper::mapLogicalOrderByToPhysical(
 
     auto orderBy =
         make_unique<OrderBy>(std::make_unique<ResultSetDescriptor>(*inSchema), orderByDataInfo,
-            orderBySharedState, std::move(prevOperator), getOperatorID(), paramsString);
+            orderBySharedState, logicalOrderBy.getTopN(), std::move(prevOperator), getOperatorID(),
+            paramsString);
     auto dispatcher = std::make_shared<KeyBlockMergeTaskDispatcher>();
     auto orderByMerge = make_unique<OrderByMerge>(orderBySharedState, std::move(dispatcher),
         std::move(orderBy), getOperatorID(), paramsString);
@@ -15,6 +15,12 @@ std::unique_ptr<PhysicalOperator> PlanMapper::mapLogicalUnionAllToPhysical(
     std::vector<std::unique_ptr<PhysicalOperator>> prevOperators;
     std::vector<std::shared_ptr<FTableSharedState>> resultCollectorSharedStates;
     for (auto i = 0u; i < logicalOperator->getNumChildren(); ++i) {
+        // Identical children are evaluated once and their result table is scanned multiple times.
+        auto identicalChildIdx = logicalUnionAll.getIdenticalChildIdx(i);
+        if (identicalChildIdx != i) {
+            resultCollectorSharedStates.push_back(resultCollectorSharedStates[identicalChildIdx]);
+            continue;
+        }
         auto child = logicalOperator->getChild(i);
         auto childSchema = logicalUnionAll.getSchemaBeforeUnion(i);
         auto prevOperator = mapLogicalOperatorToPhysical(child);
@@ -359,6 +359,11 @@ void AggregateHashTable::increaseHashSlotIdxes(uint64_t numNoMatches) {
 void AggregateHashTable::findHashSlots(const std::vector<ValueVector*>& groupByFlatHashKeyVectors,
     const std::vector<ValueVector*>& groupByUnflatHashKeyVectors,
     const std::vector<ValueVector*>& groupByNonHashKeyVectors) {
+    if (groupByFlatHashKeyVectors.empty() && groupByUnflatHashKeyVectors.size() == 1 &&
+        canFindHashSlotsWithFixedSizeKey(groupByUnflatHashKeyVectors[0])) {
+        findHashSlotsWithFixedSizeKey(groupByUnflatHashKeyVectors[0], groupByNonHashKeyVectors);
+        return;
+    }
     initTmpHashSlotsAndIdxes();
     auto numEntriesToFindHashSlots =
         groupByUnflatHashKeyVectors.empty() ?
@@ -392,6 +397,99 @@ void AggregateHashTable::findHashSlots(const std::vector<ValueVector*>& groupByF
     }
 }
 
+bool AggregateHashTable::canFindHashSlotsWithFixedSizeKey(
+    ValueVector* groupByHashKeyVector) const {
+    assert(!groupByHashKeyVector->state->isFlat());
+    switch (groupByHashKeyVector->dataType.typeID) {
+    case INTERNAL_ID:
+    case INT64:
+    case INT32:
+    case DOUBLE:
+    case DATE:
+    case TIMESTAMP:
+        // A null key never equals a non-null key, so we can only skip null checks if neither the
+        // key vector nor the key column contains nulls.
+        return groupByHashKeyVector->hasNoNullsGuarantee() &&
+               factorizedTable->hasNoNullGuarantee(0 /* colIdx */);
+    default:
+        return false;
+    }
+}
+
+void AggregateHashTable::findHashSlotsWithFixedSizeKey(ValueVector* groupByHashKeyVector,
+    const std::vector<ValueVector*>& groupByNonHashKeyVectors) {
+    switch (groupByHashKeyVector->dataType.typeID) {
+    case INTERNAL_ID: {
+        findHashSlotsWithFixedSizeKey<internalID_t>(groupByHashKeyVector, groupByNonHashKeyVectors);
+    } break;
+    case INT64: {
+        findHashSlotsWithFixedSizeKey<int64_t>(groupByHashKeyVector, groupByNonHashKeyVectors);
+    } break;
+    case INT32: {
+        findHashSlotsWithFixedSizeKey<int32_t>(groupByHashKeyVector, groupByNonHashKeyVectors);
+    } break;
+    case DOUBLE: {
+        findHashSlotsWithFixedSizeKey<double_t>(groupByHashKeyVector, groupByNonHashKeyVectors);
+    } break;
+    case DATE: {
+        findHashSlotsWithFixedSizeKey<date_t>(groupByHashKeyVector, groupByNonHashKeyVectors);
+    } break;
+    case TIMESTAMP: {
+        findHashSlotsWithFixedSizeKey<timestamp_t>(
+            groupByHashKeyVector, groupByNonHashKeyVectors);
+    } break;
+    default:
+        assert(false);
+    }
+}
+
+template<typename T>
+void AggregateHashTable::findHashSlotsWithFixedSizeKey(ValueVector* groupByHashKeyVector,
+    const std::vector<ValueVector*>& groupByNonHashKeyVectors) {
+    auto keys = (T*)groupByHashKeyVector->getData();
+    auto hashes = (hash_t*)hashVector->getData();
+    auto keyColOffset = factorizedTable->getTableSchema()->getColOffset(0 /* colIdx */);
+    auto& selVector = groupByHashKeyVector->state->selVector;
+    uint64_t numFTEntriesToInitialize = 0;
+    for (auto i = 0u; i < selVector->selectedSize; i++) {
+        auto pos = selVector->selectedPositions[i];
+        auto hash = hashes[pos];
+        auto slotIdx = getSlotIdxForHash(hash);
+        while (true) {
+            auto slot = getHashSlot(slotIdx);
+            if (slot->entry == nullptr) {
+                // The key is written right away so that duplicates later in this batch find the
+                // new entry. The remaining columns are initialized for all new entries at once.
+                slot->entry = factorizedTable->appendEmptyTuple();
+                slot->hash = hash;
+                *(T*)(slot->entry + keyColOffset) = keys[pos];
+                entryIdxesToInitialize[numFTEntriesToInitialize++] = pos;
+                hashSlotsToUpdateAggState[pos] = slot;
+                break;
+            }
+            if (slot->hash == hash && *(T*)(slot->entry + keyColOffset) == keys[pos]) {
+                hashSlotsToUpdateAggState[pos] = slot;
+                break;
+            }
+            increaseSlotIdx(slotIdx);
+        }
+    }
+    auto colIdx = 1u;
+    for (auto nonHashKeyVector : groupByNonHashKeyVectors) {
+        if (nonHashKeyVector->state->isFlat()) {
+            initializeFTEntryWithFlatVec(nonHashKeyVector, numFTEntriesToInitialize, colIdx++);
+        } else {
+            initializeFTEntryWithUnflatVec(nonHashKeyVector, numFTEntriesToInitialize, colIdx++);
+        }
+    }
+    for (auto i = 0u; i < numFTEntriesToInitialize; i++) {
+        auto entryIdx = entryIdxesToInitialize[i];
+        auto entry = hashSlotsToUpdateAggState[entryIdx]->entry;
+        fillEntryWithInitialNullAggregateState(entry);
+        factorizedTable->updateFlatCellNoNull(entry, hashColIdxInFT, &hashes[entryIdx]);
+    }
+}
+
 void AggregateHashTable::computeAndCombineVecHash(
     const std::vector<ValueVector*>& groupByHashKeyVectors, uint32_t startVecIdx) {
     for (; startVecIdx < groupByHashKeyVectors.size(); startVecIdx++) {
@@ -477,7 +575,7 @@ void AggregateHashTable::updateAggStates(const std::vector<ValueVector*>& groupB
     const std::vector<ValueVector*>& aggregateVectors, uint64_t multiplicity) {
     auto aggregateStateOffset = aggStateColOffsetInFT;
     for (auto i = 0u; i < aggregateFunctions.size(); i++) {
-        updateAggFuncs[i](this, groupByFlatHashKeyVectors, groupByUnFlatHashKeyVectors,
+        (this->*updateAggFuncs[i])(groupByFlatHashKeyVectors, groupByUnFlatHashKeyVectors,
             aggregateFunctions[i], aggregateVectors[i], multiplicity, i, aggregateStateOffset);
         aggregateStateOffset += aggregateFunctions[i]->getAggregateStateSize();
     }
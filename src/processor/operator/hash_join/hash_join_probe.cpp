@@ -67,6 +67,11 @@ bool HashJoinProbe::getMatchedTuplesForFlatKey(ExecutionContext* context) {
         }
         numMatchedTuples += isKeysEqual;
         probeState->probedTuples[0] = *sharedState->getHashTable()->getPrevTuple(currentTuple);
+        if (joinType == JoinType::MARK && numMatchedTuples > 0) {
+            // Mark join only needs to know that a match exists, so we skip the rest of the chain.
+            probeState->probedTuples[0] = nullptr;
+            break;
+        }
     }
     probeState->matchedSelVector->selectedSize = numMatchedTuples;
     probeState->nextMatchedTupleIdx = 0;
@@ -195,6 +200,11 @@ uint64_t HashJoinProbe::getJoinResult() {
 // (all flat data chunks from the build side are merged into one) and buildSideVectorPtrs (each
 // VectorPtr corresponds to one unFlat build side data chunk that is appended to the resultSet).
 bool HashJoinProbe::getNextTuplesInternal(ExecutionContext* context) {
+    // The build side is fully materialized before probing starts. An inner join with an empty build
+    // side has no result, so we avoid pulling (and computing) the probe side at all.
+    if (joinType == JoinType::INNER && sharedState->getHashTable()->getNumTuples() == 0) {
+        return false;
+    }
     uint64_t numPopulatedTuples;
     do {
         if (!getMatchedTuples(context)) {
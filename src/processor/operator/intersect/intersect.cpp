@@ -169,6 +169,12 @@ bool Intersect::hasNextTuplesToIntersect() {
 }
 
 bool Intersect::getNextTuplesInternal(ExecutionContext* context) {
+    // Skip the probe side if any build side turns out to be empty after materialization.
+    for (auto& sharedHT : sharedHTs) {
+        if (sharedHT->getHashTable()->getNumTuples() == 0) {
+            return false;
+        }
+    }
     do {
         while (carryBuildSideIdx == -1u) {
             if (!children[0]->getNextTuple(context)) {
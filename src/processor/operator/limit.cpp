@@ -4,6 +4,11 @@ namespace kuzu {
 namespace processor {
 
 bool Limit::getNextTuplesInternal(ExecutionContext* context) {
+    // The counter is shared by all threads executing this pipeline. Once another thread has
+    // reached the limit, stop without pulling (and computing) another batch from the child.
+    if (counter->load() >= limitNumber) {
+        return false;
+    }
     // end of execution due to no more input
     if (!children[0]->getNextTuple(context)) {
         return false;
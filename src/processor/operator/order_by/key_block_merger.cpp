@@ -50,75 +50,42 @@ void BlockPtrInfo::updateTuplePtrIfNecessary() {
     }
 }
 
-uint64_t KeyBlockMergeTask::findRightKeyBlockIdx(uint8_t* leftEndTuplePtr) {
-    // Find a tuple in the right memory block such that:
-    // 1. The value of the current tuple is smaller than the value in leftEndTuple.
-    // 2. Either the value of next tuple is larger than the value in leftEndTuple or
-    // the current tuple is the last tuple in the right memory block.
-    int64_t startIdx = rightKeyBlockNextIdx;
-    int64_t endIdx = rightKeyBlock->getNumTuples() - 1;
-
-    while (startIdx <= endIdx) {
-        uint64_t curTupleIdx = (startIdx + endIdx) / 2;
-        uint8_t* curTuplePtr = rightKeyBlock->getTuple(curTupleIdx);
-
-        if (keyBlockMerger.compareTuplePtr(leftEndTuplePtr, curTuplePtr)) {
-            if (curTupleIdx == rightKeyBlock->getNumTuples() - 1 ||
-                !keyBlockMerger.compareTuplePtr(
-                    leftEndTuplePtr, rightKeyBlock->getTuple(curTupleIdx + 1))) {
-                // If the current tuple is the last tuple or the value of next tuple is larger than
-                // the value of leftEndTuple, return the curTupleIdx.
-                return curTupleIdx;
-            } else {
-                startIdx = curTupleIdx + 1;
-            }
+uint64_t KeyBlockMergeTask::findLeftKeyBlockEndIdx(uint64_t resultEndIdx) {
+    // Merge path partitioning: the first resultEndIdx tuples of the merged result consist of the
+    // first i tuples of the left key block and the first resultEndIdx - i tuples of the right key
+    // block, where i is the smallest index such that left[i] > right[resultEndIdx - i - 1]. Ties
+    // are resolved in favour of the left key block, which is consistent with mergeKeyBlocks().
+    auto numLeftTuples = leftKeyBlock->getNumTuples();
+    auto numRightTuples = rightKeyBlock->getNumTuples();
+    auto startIdx = std::max(leftKeyBlockNextIdx,
+        resultEndIdx > numRightTuples ? resultEndIdx - numRightTuples : 0);
+    auto endIdx = std::min(numLeftTuples, resultEndIdx - rightKeyBlockNextIdx);
+    while (startIdx < endIdx) {
+        auto curTupleIdx = startIdx + (endIdx - startIdx) / 2;
+        if (keyBlockMerger.compareTuplePtr(leftKeyBlock->getTuple(curTupleIdx),
+                rightKeyBlock->getTuple(resultEndIdx - curTupleIdx - 1))) {
+            endIdx = curTupleIdx;
         } else {
-            endIdx = curTupleIdx - 1;
+            startIdx = curTupleIdx + 1;
         }
     }
-    // If such tuple doesn't exist, return -1.
-    return -1;
+    return startIdx;
 }
 
 std::unique_ptr<KeyBlockMergeMorsel> KeyBlockMergeTask::getMorsel() {
-    // We grab a batch of tuples from the left memory block, then do a binary search on the
-    // right memory block to find the range of tuples to merge.
+    // Each morsel produces the next batch_size tuples of the result key block, so the work of a
+    // merge task is split evenly across threads regardless of how the values of the left and right
+    // key blocks interleave.
     activeMorsels++;
-    if (rightKeyBlockNextIdx >= rightKeyBlock->getNumTuples()) {
-        // If there is no more tuples left in the right key block,
-        // just append all tuples in the left key block to the result key block.
-        auto keyBlockMergeMorsel =
-            std::make_unique<KeyBlockMergeMorsel>(leftKeyBlockNextIdx, leftKeyBlock->getNumTuples(),
-                rightKeyBlock->getNumTuples(), rightKeyBlock->getNumTuples());
-        leftKeyBlockNextIdx = leftKeyBlock->getNumTuples();
-        return keyBlockMergeMorsel;
-    }
-
-    auto leftKeyBlockStartIdx = leftKeyBlockNextIdx;
-    leftKeyBlockNextIdx += batch_size;
-
-    if (leftKeyBlockNextIdx >= leftKeyBlock->getNumTuples()) {
-        // This is the last batch of tuples in the left key block to merge, so just merge it with
-        // remaining tuples of the right key block.
-        auto keyBlockMergeMorsel = std::make_unique<KeyBlockMergeMorsel>(leftKeyBlockStartIdx,
-            std::min(leftKeyBlockNextIdx, leftKeyBlock->getNumTuples()), rightKeyBlockNextIdx,
-            rightKeyBlock->getNumTuples());
-        rightKeyBlockNextIdx = rightKeyBlock->getNumTuples();
-        return keyBlockMergeMorsel;
-    } else {
-        // Conduct a binary search to find the ending index in the right memory block.
-        auto leftEndIdxPtr = leftKeyBlock->getTuple(leftKeyBlockNextIdx - 1);
-        auto rightEndIdx = findRightKeyBlockIdx(leftEndIdxPtr);
-
-        auto keyBlockMergeMorsel = std::make_unique<KeyBlockMergeMorsel>(leftKeyBlockStartIdx,
-            std::min(leftKeyBlockNextIdx, leftKeyBlock->getNumTuples()), rightKeyBlockNextIdx,
-            rightEndIdx == -1 ? rightKeyBlockNextIdx : ++rightEndIdx);
-
-        if (rightEndIdx != -1) {
-            rightKeyBlockNextIdx = rightEndIdx;
-        }
-        return keyBlockMergeMorsel;
-    }
+    auto resultStartIdx = leftKeyBlockNextIdx + rightKeyBlockNextIdx;
+    auto resultEndIdx = std::min(resultStartIdx + batch_size, resultKeyBlock->getNumTuples());
+    auto leftKeyBlockEndIdx = findLeftKeyBlockEndIdx(resultEndIdx);
+    auto rightKeyBlockEndIdx = resultEndIdx - leftKeyBlockEndIdx;
+    auto keyBlockMergeMorsel = std::make_unique<KeyBlockMergeMorsel>(
+        leftKeyBlockNextIdx, leftKeyBlockEndIdx, rightKeyBlockNextIdx, rightKeyBlockEndIdx);
+    leftKeyBlockNextIdx = leftKeyBlockEndIdx;
+    rightKeyBlockNextIdx = rightKeyBlockEndIdx;
+    return keyBlockMergeMorsel;
 }
 
 void KeyBlockMerger::mergeKeyBlocks(KeyBlockMergeMorsel& keyBlockMergeMorsel) const {
@@ -193,10 +160,8 @@ bool KeyBlockMerger::compareTuplePtrWithStringCol(
             // they must equal to each other (since there are no other characters to compare for
             // them). If one string is long string and the other string is short string, the
             // long string must be greater than the short string.
-            bool isLeftStrLong =
-                OrderByKeyEncoder::isLongStr(leftStrColPtr, strKeyColInfo.isAscOrder);
-            bool isRightStrLong =
-                OrderByKeyEncoder::isLongStr(rightStrColPtr, strKeyColInfo.isAscOrder);
+            bool isLeftStrLong = strKeyColInfo.isLongStr(leftTuplePtr);
+            bool isRightStrLong = strKeyColInfo.isLongStr(rightTuplePtr);
             if (!isLeftStrLong && !isRightStrLong) {
                 continue;
             } else if (isLeftStrLong && !isRightStrLong) {
@@ -254,35 +219,35 @@ void KeyBlockMerger::copyRemainingBlockDataToResult(
 }
 
 std::unique_ptr<KeyBlockMergeMorsel> KeyBlockMergeTaskDispatcher::getMorsel() {
-    if (isDoneMerge()) {
-        return nullptr;
-    }
-    std::lock_guard<std::mutex> keyBlockMergeDispatcherLock{mtx};
-
-    if (!activeKeyBlockMergeTasks.empty() && activeKeyBlockMergeTasks.back()->hasMorselLeft()) {
-        // If there are morsels left in the lastMergeTask, just give it to the caller.
-        auto morsel = activeKeyBlockMergeTasks.back()->getMorsel();
-        morsel->keyBlockMergeTask = activeKeyBlockMergeTasks.back();
-        return morsel;
-    } else if (sortedKeyBlocks->size() > 1) {
-        // If there are no morsels left in the lastMergeTask, we just create a new merge task.
-        auto leftKeyBlock = sortedKeyBlocks->front();
-        sortedKeyBlocks->pop();
-        auto rightKeyBlock = sortedKeyBlocks->front();
-        sortedKeyBlocks->pop();
-        auto resultKeyBlock = std::make_shared<MergedKeyBlocks>(leftKeyBlock->getNumBytesPerTuple(),
-            leftKeyBlock->getNumTuples() + rightKeyBlock->getNumTuples(), memoryManager);
-        auto newMergeTask = std::make_shared<KeyBlockMergeTask>(
-            leftKeyBlock, rightKeyBlock, resultKeyBlock, *keyBlockMerger);
-        activeKeyBlockMergeTasks.emplace_back(newMergeTask);
-        auto morsel = newMergeTask->getMorsel();
-        morsel->keyBlockMergeTask = newMergeTask;
-        return morsel;
-    } else {
+    std::unique_lock<std::mutex> keyBlockMergeDispatcherLock{mtx};
+    while (!isDoneMergeNoLock()) {
+        if (!activeKeyBlockMergeTasks.empty() &&
+            activeKeyBlockMergeTasks.back()->hasMorselLeft()) {
+            // If there are morsels left in the lastMergeTask, just give it to the caller.
+            auto morsel = activeKeyBlockMergeTasks.back()->getMorsel();
+            morsel->keyBlockMergeTask = activeKeyBlockMergeTasks.back();
+            return morsel;
+        } else if (sortedKeyBlocks->size() > 1) {
+            // If there are no morsels left in the lastMergeTask, we just create a new merge task.
+            auto leftKeyBlock = sortedKeyBlocks->front();
+            sortedKeyBlocks->pop();
+            auto rightKeyBlock = sortedKeyBlocks->front();
+            sortedKeyBlocks->pop();
+            auto resultKeyBlock =
+                std::make_shared<MergedKeyBlocks>(leftKeyBlock->getNumBytesPerTuple(),
+                    leftKeyBlock->getNumTuples() + rightKeyBlock->getNumTuples(), memoryManager);
+            auto newMergeTask = std::make_shared<KeyBlockMergeTask>(
+                leftKeyBlock, rightKeyBlock, resultKeyBlock, *keyBlockMerger);
+            activeKeyBlockMergeTasks.emplace_back(newMergeTask);
+            auto morsel = newMergeTask->getMorsel();
+            morsel->keyBlockMergeTask = newMergeTask;
+            return morsel;
+        }
         // There is no morsel can be given at this time, just wait for the ongoing merge
         // task to finish.
-        return nullptr;
+        mergeTaskFinished.wait(keyBlockMergeDispatcherLock);
     }
+    return nullptr;
 }
 
 void KeyBlockMergeTaskDispatcher::doneMorsel(std::unique_ptr<KeyBlockMergeMorsel> morsel) {
@@ -293,6 +258,7 @@ void KeyBlockMergeTaskDispatcher::doneMorsel(std::unique_ptr<KeyBlockMergeMorsel
         !morsel->keyBlockMergeTask->hasMorselLeft()) {
         erase(activeKeyBlockMergeTasks, morsel->keyBlockMergeTask);
         sortedKeyBlocks->emplace(morsel->keyBlockMergeTask->resultKeyBlock);
+        mergeTaskFinished.notify_all();
     }
 }
 
@@ -23,7 +23,7 @@ void OrderBy::initLocalStateInternal(ResultSet* resultSet, ExecutionContext* con
     }
     orderByKeyEncoder = std::make_unique<OrderByKeyEncoder>(keyVectors, orderByDataInfo.isAscOrder,
         context->memoryManager, factorizedTableIdx, localFactorizedTable->getNumTuplesPerBlock(),
-        sharedState->numBytesPerTuple);
+        sharedState->numBytesPerTuple, sharedState->strKeyPrefixLength);
     radixSorter = std::make_unique<RadixSort>(context->memoryManager, *localFactorizedTable,
         *orderByKeyEncoder, sharedState->strKeyColsInfo);
 }
@@ -45,6 +45,7 @@ std::unique_ptr<FactorizedTableSchema> OrderBy::populateTableSchema() {
 
 void OrderBy::initGlobalStateInternal(kuzu::processor::ExecutionContext* context) {
     std::vector<StrKeyColInfo> strKeyColInfo;
+    auto strKeyPrefixLength = context->clientContext->getOrderByStringKeyPrefixLength();
     auto encodedKeyBlockColOffset = 0ul;
     auto tableSchema = populateTableSchema();
     for (auto i = 0u; i < orderByDataInfo.keysPosAndType.size(); ++i) {
@@ -61,10 +62,12 @@ void OrderBy::initGlobalStateInternal(kuzu::processor::ExecutionContext* context
             }
             strKeyColInfo.emplace_back(
                 StrKeyColInfo(tableSchema->getColOffset(factorizedTableColIdx),
-                    encodedKeyBlockColOffset, orderByDataInfo.isAscOrder[i]));
+                    encodedKeyBlockColOffset, orderByDataInfo.isAscOrder[i], strKeyPrefixLength));
         }
-        encodedKeyBlockColOffset += OrderByKeyEncoder::getEncodingSize(dataType);
+        encodedKeyBlockColOffset +=
+            OrderByKeyEncoder::getEncodingSize(dataType, strKeyPrefixLength);
     }
+    sharedState->setStrKeyPrefixLength(strKeyPrefixLength);
     sharedState->setStrKeyColInfo(strKeyColInfo);
     // TODO(Ziyi): comment about +8
     auto numBytesPerTuple = encodedKeyBlockColOffset + 8;
@@ -89,6 +92,9 @@ void OrderBy::executeInternal(ExecutionContext* context) {
     for (auto& keyBlock : orderByKeyEncoder->getKeyBlocks()) {
         if (keyBlock->numTuples > 0) {
             radixSorter->sortSingleKeyBlock(*keyBlock);
+            // Tuples beyond the first topN of a sorted key block cannot be in the first topN of
+            // the merged result, so we drop them before merging.
+            keyBlock->numTuples = std::min<uint64_t>(keyBlock->numTuples, topN);
             sharedState->appendSortedKeyBlock(
                 make_shared<MergedKeyBlocks>(orderByKeyEncoder->getNumBytesPerTuple(), keyBlock));
         }
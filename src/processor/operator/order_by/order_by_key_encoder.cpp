@@ -14,16 +14,16 @@ namespace processor {
 
 OrderByKeyEncoder::OrderByKeyEncoder(std::vector<ValueVector*>& orderByVectors,
     std::vector<bool>& isAscOrder, MemoryManager* memoryManager, uint8_t ftIdx,
-    uint32_t numTuplesPerBlockInFT, uint32_t numBytesPerTuple)
+    uint32_t numTuplesPerBlockInFT, uint32_t numBytesPerTuple, uint32_t strKeyPrefixLength)
     : memoryManager{memoryManager}, orderByVectors{orderByVectors}, isAscOrder{isAscOrder},
-      numBytesPerTuple{numBytesPerTuple}, ftIdx{ftIdx},
+      numBytesPerTuple{numBytesPerTuple}, strKeyPrefixLength{strKeyPrefixLength}, ftIdx{ftIdx},
       numTuplesPerBlockInFT{numTuplesPerBlockInFT}, swapBytes{isLittleEndian()} {
     if (numTuplesPerBlockInFT > MAX_FT_BLOCK_OFFSET) {
         throw RuntimeException(
             "The number of tuples per block of factorizedTable exceeds the maximum blockOffset!");
     }
     keyBlocks.emplace_back(std::make_unique<DataBlock>(memoryManager));
-    assert(this->numBytesPerTuple == getNumBytesPerTuple());
+    assert(this->numBytesPerTuple == getNumBytesPerTuple(orderByVectors, strKeyPrefixLength));
     maxNumTuplesPerBlock = BufferPoolConstants::PAGE_256KB_SIZE / numBytesPerTuple;
     if (maxNumTuplesPerBlock <= 0) {
         throw RuntimeException(StringUtils::string_format(
@@ -49,7 +49,8 @@ void OrderByKeyEncoder::encodeKeys() {
         for (auto keyColIdx = 0u; keyColIdx < orderByVectors.size(); keyColIdx++) {
             encodeVector(orderByVectors[keyColIdx], tuplePtr + tuplePtrOffset, encodedTuples,
                 numEntriesToEncode, keyColIdx);
-            tuplePtrOffset += getEncodingSize(orderByVectors[keyColIdx]->dataType);
+            tuplePtrOffset +=
+                getEncodingSize(orderByVectors[keyColIdx]->dataType, strKeyPrefixLength);
         }
         encodeFTIdx(numEntriesToEncode, tuplePtr + tuplePtrOffset);
         encodedTuples += numEntriesToEncode;
@@ -58,21 +59,23 @@ void OrderByKeyEncoder::encodeKeys() {
     }
 }
 
-uint32_t OrderByKeyEncoder::getNumBytesPerTuple(const std::vector<ValueVector*>& keyVectors) {
+uint32_t OrderByKeyEncoder::getNumBytesPerTuple(
+    const std::vector<ValueVector*>& keyVectors, uint32_t strKeyPrefixLength) {
     uint32_t result = 0u;
     for (auto& vector : keyVectors) {
-        result += getEncodingSize(vector->dataType);
+        result += getEncodingSize(vector->dataType, strKeyPrefixLength);
     }
     result += 8;
     return result;
 }
 
-uint32_t OrderByKeyEncoder::getEncodingSize(const DataType& dataType) {
+uint32_t OrderByKeyEncoder::getEncodingSize(
+    const DataType& dataType, uint32_t strKeyPrefixLength) {
     // Add one more byte for null flag.
     switch (dataType.typeID) {
     case STRING:
-        // 1 byte for null flag + 1 byte to indicate long/short string + 12 bytes for string prefix
-        return 2 + ku_string_t::SHORT_STR_LENGTH;
+        // 1 byte for null flag + 1 byte to indicate long/short string + the string prefix
+        return 2 + strKeyPrefixLength;
     default:
         return 1 + Types::getDataTypeSize(dataType);
     }
@@ -81,7 +84,7 @@ uint32_t OrderByKeyEncoder::getEncodingSize(const DataType& dataType) {
 void OrderByKeyEncoder::flipBytesIfNecessary(
     uint32_t keyColIdx, uint8_t* tuplePtr, uint32_t numEntriesToEncode, DataType& type) {
     if (!isAscOrder[keyColIdx]) {
-        auto encodingSize = getEncodingSize(type);
+        auto encodingSize = getEncodingSize(type, strKeyPrefixLength);
         // If the current column is in desc order, flip all bytes.
         for (auto i = 0u; i < numEntriesToEncode; i++) {
             for (auto byte = 0u; byte < encodingSize; ++byte) {
@@ -96,7 +99,7 @@ void OrderByKeyEncoder::encodeFlatVector(
     ValueVector* vector, uint8_t* tuplePtr, uint32_t keyColIdx) {
     auto pos = vector->state->selVector->selectedPositions[0];
     if (vector->isNull(pos)) {
-        for (auto j = 0u; j < getEncodingSize(vector->dataType); j++) {
+        for (auto j = 0u; j < getEncodingSize(vector->dataType, strKeyPrefixLength); j++) {
             *(tuplePtr + j) = UINT8_MAX;
         }
     } else {
@@ -120,7 +123,8 @@ void OrderByKeyEncoder::encodeUnflatVector(ValueVector* vector, uint8_t* tuplePt
         } else {
             for (auto i = 0u; i < numEntriesToEncode; i++) {
                 if (vector->isNull(encodedTuples + i)) {
-                    for (auto j = 0u; j < getEncodingSize(vector->dataType); j++) {
+                    for (auto j = 0u; j < getEncodingSize(vector->dataType, strKeyPrefixLength);
+                         j++) {
                         *(tuplePtr + j) = UINT8_MAX;
                     }
                 } else {
@@ -146,7 +150,8 @@ void OrderByKeyEncoder::encodeUnflatVector(ValueVector* vector, uint8_t* tuplePt
             for (auto i = 0u; i < numEntriesToEncode; i++) {
                 auto pos = vector->state->selVector->selectedPositions[i + encodedTuples];
                 if (vector->isNull(pos)) {
-                    for (auto j = 0u; j < getEncodingSize(vector->dataType); j++) {
+                    for (auto j = 0u; j < getEncodingSize(vector->dataType, strKeyPrefixLength);
+                         j++) {
                         *(tuplePtr + j) = UINT8_MAX;
                     }
                 } else {
@@ -197,7 +202,7 @@ void OrderByKeyEncoder::allocateMemoryIfFull() {
     }
 }
 
-encode_function_t OrderByKeyEncoder::getEncodingFunction(DataTypeID typeId) {
+encode_function_t OrderByKeyEncoder::getEncodingFunction(DataTypeID typeId) const {
     switch (typeId) {
     case BOOL: {
         return encodeTemplate<bool>;
@@ -218,7 +223,10 @@ encode_function_t OrderByKeyEncoder::getEncodingFunction(DataTypeID typeId) {
         return encodeTemplate<float_t>;
     }
     case STRING: {
-        return encodeTemplate<ku_string_t>;
+        return [prefixLength = strKeyPrefixLength](
+                   const uint8_t* data, uint8_t* resultPtr, bool /* swapBytes */) {
+            encodeString(*(ku_string_t*)data, resultPtr, prefixLength);
+        };
     }
     case DATE: {
         return encodeTemplate<date_t>;
@@ -303,15 +311,15 @@ void OrderByKeyEncoder::encodeData(interval_t data, uint8_t* resultPtr, bool swa
     encodeData(micros, resultPtr, swapBytes);
 }
 
-template<>
-void OrderByKeyEncoder::encodeData(ku_string_t data, uint8_t* resultPtr, bool swapBytes) {
-    // Only encode the prefix of ku_string.
-    memcpy(resultPtr, (void*)data.getAsString().c_str(),
-        std::min((uint32_t)ku_string_t::SHORT_STR_LENGTH, data.len));
-    if (ku_string_t::isShortString(data.len)) {
-        memset(resultPtr + data.len, '\0', ku_string_t::SHORT_STR_LENGTH + 1 - data.len);
+void OrderByKeyEncoder::encodeString(
+    const ku_string_t& data, uint8_t* resultPtr, uint32_t strKeyPrefixLength) {
+    // Only encode the prefix of ku_string. Bytes past the end of a short string are zero, so a
+    // string sorts before all strings that it is a proper prefix of.
+    memcpy(resultPtr, data.getData(), std::min(strKeyPrefixLength, data.len));
+    if (data.len <= strKeyPrefixLength) {
+        memset(resultPtr + data.len, '\0', strKeyPrefixLength + 1 - data.len);
     } else {
-        resultPtr[12] = UINT8_MAX;
+        resultPtr[strKeyPrefixLength] = UINT8_MAX;
     }
 }
 
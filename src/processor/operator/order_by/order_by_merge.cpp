@@ -1,7 +1,5 @@
 #include "processor/operator/order_by/order_by_merge.h"
 
-#include "common/constants.h"
-
 using namespace kuzu::common;
 
 namespace kuzu {
@@ -15,13 +13,8 @@ void OrderByMerge::initLocalStateInternal(ResultSet* resultSet, ExecutionContext
 }
 
 void OrderByMerge::executeInternal(ExecutionContext* context) {
-    while (!sharedDispatcher->isDoneMerge()) {
-        auto keyBlockMergeMorsel = sharedDispatcher->getMorsel();
-        if (keyBlockMergeMorsel == nullptr) {
-            std::this_thread::sleep_for(
-                std::chrono::microseconds(THREAD_SLEEP_TIME_WHEN_WAITING_IN_MICROS));
-            continue;
-        }
+    // getMorsel() blocks until a morsel is available and returns nullptr once merging is done.
+    while (auto keyBlockMergeMorsel = sharedDispatcher->getMorsel()) {
         localMerger->mergeKeyBlocks(*keyBlockMergeMorsel);
         sharedDispatcher->doneMorsel(std::move(keyBlockMergeMorsel));
     }
@@ -16,8 +16,9 @@ void OrderByScan::initLocalStateInternal(ResultSet* resultSet, ExecutionContext*
 bool OrderByScan::getNextTuplesInternal(ExecutionContext* context) {
     // If there is no more tuples to read, just return false.
     if (mergedKeyBlockScanState == nullptr ||
-        mergedKeyBlockScanState->nextTupleIdxToReadInMergedKeyBlock >=
-            mergedKeyBlockScanState->mergedKeyBlock->getNumTuples()) {
+        (mergedKeyBlockScanState->nextTupleIdxToReadInMergedKeyBlock >=
+                mergedKeyBlockScanState->endTupleIdxToReadInMergedKeyBlock &&
+            !getNextMorsel())) {
         return false;
     } else {
         // If there is an unflat col in factorizedTable, we can only read one
@@ -39,7 +40,7 @@ bool OrderByScan::getNextTuplesInternal(ExecutionContext* context) {
             metrics->numOutputTuple.increase(1);
         } else {
             auto numTuplesToRead = std::min(DEFAULT_VECTOR_CAPACITY,
-                mergedKeyBlockScanState->mergedKeyBlock->getNumTuples() -
+                mergedKeyBlockScanState->endTupleIdxToReadInMergedKeyBlock -
                     mergedKeyBlockScanState->nextTupleIdxToReadInMergedKeyBlock);
             auto numTuplesRead = 0;
             while (numTuplesRead < numTuplesToRead) {
@@ -83,7 +84,9 @@ void OrderByScan::initMergedKeyBlockScanState() {
         return;
     }
     mergedKeyBlockScanState = std::make_unique<MergedKeyBlockScanState>();
+    mergedKeyBlockScanState->morselIdx = UINT64_MAX;
     mergedKeyBlockScanState->nextTupleIdxToReadInMergedKeyBlock = 0;
+    mergedKeyBlockScanState->endTupleIdxToReadInMergedKeyBlock = 0;
     mergedKeyBlockScanState->mergedKeyBlock = sharedState->sortedKeyBlocks->front();
     mergedKeyBlockScanState->tupleIdxAndFactorizedTableIdxOffset =
         mergedKeyBlockScanState->mergedKeyBlock->getNumBytesPerTuple() - 8;
@@ -94,9 +97,19 @@ void OrderByScan::initMergedKeyBlockScanState() {
         mergedKeyBlockScanState->tuplesToRead =
             std::make_unique<uint8_t*[]>(DEFAULT_VECTOR_CAPACITY);
     }
-    mergedKeyBlockScanState->blockPtrInfo = make_unique<BlockPtrInfo>(0 /* startTupleIdx */,
-        mergedKeyBlockScanState->mergedKeyBlock->getNumTuples(),
-        mergedKeyBlockScanState->mergedKeyBlock);
+}
+
+bool OrderByScan::getNextMorsel() {
+    auto morsel = sharedState->getScanMorsel();
+    if (morsel == nullptr) {
+        return false;
+    }
+    mergedKeyBlockScanState->morselIdx = morsel->morselIdx;
+    mergedKeyBlockScanState->nextTupleIdxToReadInMergedKeyBlock = morsel->startTupleIdx;
+    mergedKeyBlockScanState->endTupleIdxToReadInMergedKeyBlock = morsel->endTupleIdx;
+    mergedKeyBlockScanState->blockPtrInfo = make_unique<BlockPtrInfo>(
+        morsel->startTupleIdx, morsel->endTupleIdx, mergedKeyBlockScanState->mergedKeyBlock);
+    return true;
 }
 
 } // namespace processor
@@ -32,9 +32,17 @@ void RadixSort::sortSingleKeyBlock(const DataBlock& keyBlock) {
                              numBytesSorted,
                     keyBlockTie.getNumTuples(), numBytesToSort, keyBlockTie.startingTupleIdx);
             for (auto& newTieInKeyBlock : newTiesInKeyBlock) {
-                solveStringTies(newTieInKeyBlock,
-                    keyBlock.getData() + newTieInKeyBlock.startingTupleIdx * numBytesPerTuple, ties,
-                    strKeyColsInfo[i]);
+                auto tiePtr =
+                    keyBlock.getData() + newTieInKeyBlock.startingTupleIdx * numBytesPerTuple;
+                // Tuples in a tie have the same encoding of the string column. Unless the strings
+                // are longer than the encoded prefix, the strings are equal and only the
+                // following columns can break the tie, so we skip fetching them from the
+                // factorizedTable.
+                if (!strKeyColsInfo[i].isNull(tiePtr) && strKeyColsInfo[i].isLongStr(tiePtr)) {
+                    solveStringTies(newTieInKeyBlock, tiePtr, ties, strKeyColsInfo[i]);
+                } else {
+                    ties.push(newTieInKeyBlock);
+                }
             }
         }
         if (ties.empty()) {
@@ -148,8 +156,7 @@ void RadixSort::findStringTies(TieRange& keyBlockTie, uint8_t* keyBlockPtr,
             iTuplePtr + keyColInfo.colOffsetInEncodedKeyBlock, keyColInfo.isAscOrder);
         // This variable will only be used when the current column is a string column. Otherwise,
         // we just set this variable to false.
-        bool isIStringLong = OrderByKeyEncoder::isLongStr(
-            iTuplePtr + keyColInfo.colOffsetInEncodedKeyBlock, keyColInfo.isAscOrder);
+        bool isIStringLong = keyColInfo.isLongStr(iTuplePtr);
         TYPE iValue =
             isIValNull ?
                 TYPE() :
@@ -178,8 +185,7 @@ void RadixSort::findStringTies(TieRange& keyBlockTie, uint8_t* keyBlockPtr,
                 // tuples from factorizedTable. If both left and right string are short, they
                 // must equal to each other (since they have the same prefix). If one string is
                 // short and the other string is long, then they must not equal to each other.
-                bool isJStringLong = OrderByKeyEncoder::isLongStr(
-                    jTuplePtr + keyColInfo.colOffsetInEncodedKeyBlock, keyColInfo.isAscOrder);
+                bool isJStringLong = keyColInfo.isLongStr(jTuplePtr);
                 if (!isIStringLong && !isJStringLong) {
                     jTupleInfoPtr += numBytesPerTuple;
                     continue;
@@ -232,10 +238,8 @@ void RadixSort::solveStringTies(TieRange& keyBlockTie, uint8_t* keyBlockPtr,
 
             // We only need to fetch the actual strings from the
             // factorizedTable when both left and right strings are long string.
-            auto isLeftLongStr = OrderByKeyEncoder::isLongStr(
-                leftPtr + keyColInfo.colOffsetInEncodedKeyBlock, keyColInfo.isAscOrder);
-            auto isRightLongStr = OrderByKeyEncoder::isLongStr(
-                rightPtr + keyColInfo.colOffsetInEncodedKeyBlock, keyColInfo.isAscOrder);
+            auto isLeftLongStr = keyColInfo.isLongStr(leftPtr);
+            auto isRightLongStr = keyColInfo.isLongStr(rightPtr);
             if (!isLeftLongStr && !isRightLongStr) {
                 // If left and right are both short string and have the same prefix, we can't
                 // conclude that the left string is smaller than the right string.
@@ -113,6 +113,9 @@ std::string PhysicalOperatorUtils::operatorTypeToString(PhysicalOperatorType ope
     case PhysicalOperatorType::SCAN_REL_TABLE_LISTS: {
         return "SCAN_REL_TABLE_LISTS";
     }
+    case PhysicalOperatorType::SCAN_REL_TABLE_LISTS_DEGREE: {
+        return "SCAN_REL_TABLE_LISTS_DEGREE";
+    }
     case PhysicalOperatorType::SCAN_BFS_LEVEL: {
         return "SCAN_BFS_LEVEL";
     }
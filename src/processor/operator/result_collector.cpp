@@ -1,5 +1,7 @@
 #include "processor/operator/result_collector.h"
 
+#include "common/assert.h"
+
 using namespace kuzu::common;
 using namespace kuzu::storage;
 
@@ -22,6 +24,25 @@ std::unique_ptr<FTableScanMorsel> FTableSharedState::getMorsel(uint64_t maxMorse
     return morsel;
 }
 
+void FTableSharedState::mergeLocalTable(
+    uint64_t morselIdx, std::unique_ptr<FactorizedTable> localTable) {
+    std::lock_guard<std::mutex> lck{mtx};
+    pendingLocalTables.emplace(morselIdx, std::move(localTable));
+    while (!pendingLocalTables.empty() &&
+           pendingLocalTables.begin()->first == nextMorselIdxToMerge) {
+        table->mergeInOrder(*pendingLocalTables.begin()->second);
+        pendingLocalTables.erase(pendingLocalTables.begin());
+        nextMorselIdxToMerge++;
+    }
+}
+
+void FTableSharedState::assertAllLocalTablesMerged() {
+    std::lock_guard<std::mutex> lck{mtx};
+    // Every morsel of an order by scan produces tuples, so there is no gap in the morsel indices
+    // and every local table has been merged once the pipeline finishes.
+    KU_ASSERT(pendingLocalTables.empty());
+}
+
 void ResultCollector::initLocalStateInternal(ResultSet* resultSet, ExecutionContext* context) {
     for (auto [dataPos, _] : payloadsPosAndType) {
         auto vector =
@@ -29,25 +50,56 @@ void ResultCollector::initLocalStateInternal(ResultSet* resultSet, ExecutionCont
         vectorsToCollect.push_back(vector.get());
     }
     localTable = std::make_unique<FactorizedTable>(context->memoryManager, populateTableSchema());
+    orderByScan = getOrderByScan(children[0].get());
 }
 
 void ResultCollector::executeInternal(ExecutionContext* context) {
     while (children[0]->getNextTuple(context)) {
         if (!vectorsToCollect.empty()) {
+            if (orderByScan != nullptr && orderByScan->getMorselIdx() != localTableMorselIdx) {
+                // Each morsel of an order by scan is collected into its own local table.
+                mergeLocalTable(context);
+                localTableMorselIdx = orderByScan->getMorselIdx();
+            }
             for (auto i = 0u; i < resultSet->multiplicity; i++) {
                 localTable->append(vectorsToCollect);
             }
         }
     }
     if (!vectorsToCollect.empty()) {
-        sharedState->mergeLocalTable(*localTable);
+        mergeLocalTable(context);
     }
 }
 
+void ResultCollector::finalize(ExecutionContext* context) {
+    sharedState->assertAllLocalTablesMerged();
+}
+
 void ResultCollector::initGlobalStateInternal(ExecutionContext* context) {
     sharedState->initTableIfNecessary(context->memoryManager, populateTableSchema());
 }
 
+OrderByScan* ResultCollector::getOrderByScan(PhysicalOperator* op) {
+    while (op->getOperatorType() == PhysicalOperatorType::PROJECTION) {
+        op = op->getChild(0);
+    }
+    return op->getOperatorType() == PhysicalOperatorType::ORDER_BY_SCAN ? (OrderByScan*)op :
+                                                                           nullptr;
+}
+
+void ResultCollector::mergeLocalTable(ExecutionContext* context) {
+    if (orderByScan == nullptr) {
+        sharedState->mergeLocalTable(*localTable);
+        return;
+    }
+    if (localTableMorselIdx == UINT64_MAX) {
+        // No tuple has been collected yet.
+        return;
+    }
+    sharedState->mergeLocalTable(localTableMorselIdx, std::move(localTable));
+    localTable = std::make_unique<FactorizedTable>(context->memoryManager, populateTableSchema());
+}
+
 std::unique_ptr<FactorizedTableSchema> ResultCollector::populateTableSchema() {
     std::unique_ptr<FactorizedTableSchema> tableSchema = std::make_unique<FactorizedTableSchema>();
     for (auto i = 0u; i < payloadsPosAndType.size(); ++i) {
@@ -57,6 +109,9 @@ std::unique_ptr<FactorizedTableSchema> ResultCollector::populateTableSchema() {
                 isPayloadFlat[i] ? Types::getDataTypeSize(dataType) :
                                    (uint32_t)sizeof(overflow_value_t)));
     }
+    // Collected tables are only read column by column through scan() and the flat tuple iterator,
+    // so they are stored column-wise within each block.
+    tableSchema->setColumnar(true);
     return tableSchema;
 }
 
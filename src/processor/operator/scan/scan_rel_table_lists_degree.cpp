@@ -0,0 +1,30 @@
+#include "processor/operator/scan/scan_rel_table_lists_degree.h"
+
+namespace kuzu {
+namespace processor {
+
+bool ScanRelTableListsDegree::getNextTuplesInternal(ExecutionContext* context) {
+    resultSet->multiplicity = prevMultiplicity;
+    uint64_t degree;
+    do {
+        if (!children[0]->getNextTuple(context)) {
+            return false;
+        }
+        auto pos = inNodeIDVector->state->selVector->selectedPositions[0];
+        if (inNodeIDVector->isNull(pos)) {
+            degree = 0;
+            continue;
+        }
+        auto nodeOffset = inNodeIDVector->readNodeOffset(pos);
+        degree = adjLists->getTotalNumElementsInList(transaction->getType(), nodeOffset);
+    } while (degree == 0);
+    prevMultiplicity = resultSet->multiplicity;
+    resultSet->multiplicity *= degree;
+    // The neighbour vector is never read, but its chunk must hold one tuple to be multiplied in.
+    outputVectors[0]->state->initOriginalAndSelectedSize(1);
+    metrics->numOutputTuple.increase(degree);
+    return true;
+}
+
+} // namespace processor
+} // namespace kuzu
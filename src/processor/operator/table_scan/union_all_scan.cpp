@@ -13,19 +13,21 @@ uint64_t UnionAllScanSharedState::getMaxMorselSize() const {
 
 std::unique_ptr<FTableScanMorsel> UnionAllScanSharedState::getMorsel(uint64_t maxMorselSize) {
     std::lock_guard<std::mutex> lck{mtx};
-    if (fTableToScanIdx == fTableSharedStates.size()) { // No more to scan.
-        return std::make_unique<FTableScanMorsel>(nullptr, 0, 0);
-    }
-    auto morsel = fTableSharedStates[fTableToScanIdx]->getMorsel(maxMorselSize);
-    // Fetch next table if current table has nothing to scan.
-    while (morsel->numTuples == 0) {
-        fTableToScanIdx++;
-        if (fTableToScanIdx == fTableSharedStates.size()) { // No more to scan.
-            return std::make_unique<FTableScanMorsel>(nullptr, 0, 0);
+    while (fTableToScanIdx < fTableSharedStates.size()) {
+        auto table = fTableSharedStates[fTableToScanIdx]->getTable().get();
+        if (nextTupleIdxToScan < table->getNumTuples()) {
+            auto numTuplesToScan =
+                std::min(maxMorselSize, table->getNumTuples() - nextTupleIdxToScan);
+            auto morsel =
+                std::make_unique<FTableScanMorsel>(table, nextTupleIdxToScan, numTuplesToScan);
+            nextTupleIdxToScan += numTuplesToScan;
+            return morsel;
         }
-        morsel = fTableSharedStates[fTableToScanIdx]->getMorsel(maxMorselSize);
+        // Fetch next table if current table has nothing to scan.
+        fTableToScanIdx++;
+        nextTupleIdxToScan = 0;
     }
-    return morsel;
+    return std::make_unique<FTableScanMorsel>(nullptr, 0, 0); // No more to scan.
 }
 
 } // namespace processor
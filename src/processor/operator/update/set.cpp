@@ -3,6 +3,15 @@
 namespace kuzu {
 namespace processor {
 
+bool SetNodeProperty::updatesOnlyNodesAt(const DataPos& nodeIDPos) const {
+    for (auto& info : infos) {
+        if (!(info->nodeIDPos == nodeIDPos)) {
+            return false;
+        }
+    }
+    return true;
+}
+
 void SetNodeProperty::initLocalStateInternal(ResultSet* resultSet, ExecutionContext* context) {
     for (auto& info : infos) {
         auto nodeIDVector = resultSet->getValueVector(info->nodeIDPos);
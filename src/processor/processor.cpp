@@ -3,7 +3,9 @@
 #include "processor/operator/aggregate/base_aggregate.h"
 #include "processor/operator/copy/copy.h"
 #include "processor/operator/result_collector.h"
+#include "processor/operator/scan_node_id.h"
 #include "processor/operator/sink.h"
+#include "processor/operator/update/set.h"
 #include "processor/processor_task.h"
 
 using namespace kuzu::common;
@@ -59,8 +61,25 @@ void QueryProcessor::decomposePlanIntoTasks(
         }
     }
     switch (op->getOperatorType()) {
-        // Ordered table should be scanned in single-thread mode.
-    case PhysicalOperatorType::ORDER_BY_MERGE:
+        // Ordered table should be scanned in single-thread mode, unless the result collector of the
+        // scanning pipeline restores the order of the scanned morsels.
+    case PhysicalOperatorType::ORDER_BY_MERGE: {
+        auto sink = ((ProcessorTask*)parentTask)->getSink();
+        if (sink->getOperatorType() != PhysicalOperatorType::RESULT_COLLECTOR ||
+            !((ResultCollector*)sink)->canCollectInScanOrder()) {
+            parentTask->setSingleThreadedTask();
+        }
+    } break;
+        // Column updates are synchronized by the WAL page idx locks of the updated pages, and
+        // overflow files and the WAL have their own locks. A node that is updated from several
+        // threads would still lose updates of read-modify-writes, e.g., SET b.age = b.age + 1. So
+        // SET_NODE_PROPERTY runs in parallel only if it updates the nodes scanned by the pipeline
+        // source, whose morsels partition the nodes by offset.
+    case PhysicalOperatorType::SET_NODE_PROPERTY: {
+        if (!canSetNodePropertyInParallel((SetNodeProperty*)op)) {
+            parentTask->setSingleThreadedTask();
+        }
+    } break;
         // DDL should be executed exactly once.
     case PhysicalOperatorType::CREATE_NODE_TABLE:
     case PhysicalOperatorType::CREATE_REL_TABLE:
@@ -69,8 +88,8 @@ void QueryProcessor::decomposePlanIntoTasks(
     case PhysicalOperatorType::ADD_PROPERTY:
     case PhysicalOperatorType::RENAME_PROPERTY:
     case PhysicalOperatorType::RENAME_TABLE:
-        // As a temporary solution, update is executed in single thread mode.
-    case PhysicalOperatorType::SET_NODE_PROPERTY:
+        // Other updates also modify the PK index, lists updates stores or node statistics, which
+        // are not thread-safe, so they are executed in single thread mode.
     case PhysicalOperatorType::SET_REL_PROPERTY:
     case PhysicalOperatorType::CREATE_NODE:
     case PhysicalOperatorType::CREATE_REL:
@@ -83,6 +102,16 @@ void QueryProcessor::decomposePlanIntoTasks(
     }
 }
 
+bool QueryProcessor::canSetNodePropertyInParallel(SetNodeProperty* setNodeProperty) {
+    // Operators of the same pipeline are chained through their first child.
+    PhysicalOperator* op = setNodeProperty;
+    while (!op->isSource() && !op->isSink() && op->getNumChildren() > 0) {
+        op = op->getChild(0);
+    }
+    return op->getOperatorType() == PhysicalOperatorType::SCAN_NODE_ID &&
+           setNodeProperty->updatesOnlyNodesAt(((ScanNodeID*)op)->getOutDataPos());
+}
+
 std::shared_ptr<FactorizedTable> QueryProcessor::getFactorizedTableForOutputMsg(
     std::string& outputMsg, MemoryManager* memoryManager) {
     auto ftTableSchema = std::make_unique<FactorizedTableSchema>();
@@ -10,6 +10,9 @@ void ProcessorTask::run() {
     auto clonedPipelineRoot = sink->clone();
     lck.unlock();
     auto currentSink = (Sink*)clonedPipelineRoot.get();
+    if (canYield()) {
+        getPipelineSource(currentSink)->setTaskToYield(this);
+    }
     auto resultSet = populateResultSet(currentSink, executionContext->memoryManager);
     currentSink->execute(resultSet.get(), executionContext);
 }
@@ -18,6 +21,22 @@ void ProcessorTask::finalizeIfNecessary() {
     sink->finalize(executionContext);
 }
 
+bool ProcessorTask::canYield() const {
+    return !singleThreaded && getPipelineSource(sink)->canYieldBetweenMorsels();
+}
+
+PhysicalOperator* ProcessorTask::getPipelineSource(PhysicalOperator* op) {
+    // Operators of the same pipeline are chained through their first child.
+    if (op->getNumChildren() == 0) {
+        return op;
+    }
+    op = op->getChild(0);
+    while (!op->isSource() && !op->isSink() && op->getNumChildren() > 0) {
+        op = op->getChild(0);
+    }
+    return op;
+}
+
 std::unique_ptr<ResultSet> ProcessorTask::populateResultSet(
     Sink* op, storage::MemoryManager* memoryManager) {
     auto resultSetDescriptor = op->getResultSetDescriptor();
@@ -20,6 +20,7 @@ FactorizedTableSchema::FactorizedTableSchema(const FactorizedTableSchema& other)
     for (auto& column : other.columns) {
         appendColumn(std::make_unique<ColumnSchema>(*column));
     }
+    columnar = other.columnar;
 }
 
 void FactorizedTableSchema::appendColumn(std::unique_ptr<ColumnSchema> column) {
@@ -41,7 +42,7 @@ bool FactorizedTableSchema::operator==(const FactorizedTableSchema& other) const
         }
     }
     return numBytesForDataPerTuple == other.numBytesForDataPerTuple && numBytesForNullMapPerTuple &&
-           other.numBytesForNullMapPerTuple;
+           other.numBytesForNullMapPerTuple && columnar == other.columnar;
 }
 
 void DataBlock::copyTuples(DataBlock* blockToCopyFrom, ft_tuple_idx_t tupleIdxToCopyFrom,
@@ -70,20 +71,62 @@ void DataBlockCollection::merge(DataBlockCollection& other) {
     auto newLastBlock = blocks.back().get();
     auto numTuplesToAppendIntoNewLastBlock =
         std::min(numTuplesPerBlock - newLastBlock->numTuples, oldLastBlock->numTuples);
-    DataBlock::copyTuples(oldLastBlock.get(), 0, newLastBlock, newLastBlock->numTuples,
-        numTuplesToAppendIntoNewLastBlock, numBytesPerTuple);
+    copyTuples(oldLastBlock.get(), 0, newLastBlock, newLastBlock->numTuples,
+        numTuplesToAppendIntoNewLastBlock);
     // If any tuples left in the old last block, shift them to the beginning, and push the old last
     // block back.
     auto numTuplesLeftForNewBlock = oldLastBlock->numTuples - numTuplesToAppendIntoNewLastBlock;
     if (numTuplesLeftForNewBlock > 0) {
         auto tupleIdxInOldLastBlock = numTuplesToAppendIntoNewLastBlock;
         oldLastBlock->resetNumTuplesAndFreeSize();
-        DataBlock::copyTuples(oldLastBlock.get(), tupleIdxInOldLastBlock, oldLastBlock.get(), 0,
-            numTuplesLeftForNewBlock, numBytesPerTuple);
+        copyTuples(oldLastBlock.get(), tupleIdxInOldLastBlock, oldLastBlock.get(), 0,
+            numTuplesLeftForNewBlock);
         blocks.push_back(std::move(oldLastBlock));
     }
 }
 
+void DataBlockCollection::mergeInOrder(DataBlockCollection& other) {
+    if (blocks.empty() || blocks.back()->numTuples == numTuplesPerBlock) {
+        append(std::move(other.blocks));
+        return;
+    }
+    for (auto& otherBlock : other.blocks) {
+        auto numCopiedTuples = 0u;
+        while (numCopiedTuples < otherBlock->numTuples) {
+            if (blocks.back()->numTuples == numTuplesPerBlock) {
+                blocks.push_back(std::make_unique<DataBlock>(otherBlock->memoryManager));
+            }
+            auto lastBlock = blocks.back().get();
+            auto numTuplesToCopy = std::min(
+                numTuplesPerBlock - lastBlock->numTuples, otherBlock->numTuples - numCopiedTuples);
+            copyTuples(otherBlock.get(), numCopiedTuples, lastBlock, lastBlock->numTuples,
+                numTuplesToCopy);
+            numCopiedTuples += numTuplesToCopy;
+        }
+    }
+    other.blocks.clear();
+}
+
+void DataBlockCollection::copyTuples(DataBlock* blockToCopyFrom,
+    ft_block_offset_t blockOffsetToCopyFrom, DataBlock* blockToCopyInto,
+    ft_block_offset_t blockOffsetToCopyTo, uint32_t numTuplesToCopy) {
+    if (minipageValueSizes.empty()) {
+        DataBlock::copyTuples(blockToCopyFrom, blockOffsetToCopyFrom, blockToCopyInto,
+            blockOffsetToCopyTo, numTuplesToCopy, numBytesPerTuple);
+        return;
+    }
+    // Tuples may be shifted within the same block, so the source and destination can overlap.
+    auto minipageOffset = 0ul;
+    for (auto valueSize : minipageValueSizes) {
+        memmove(blockToCopyInto->getData() + minipageOffset + blockOffsetToCopyTo * valueSize,
+            blockToCopyFrom->getData() + minipageOffset + blockOffsetToCopyFrom * valueSize,
+            numTuplesToCopy * valueSize);
+        minipageOffset += numTuplesPerBlock * valueSize;
+    }
+    blockToCopyInto->numTuples += numTuplesToCopy;
+    blockToCopyInto->freeSize -= numTuplesToCopy * numBytesPerTuple;
+}
+
 FactorizedTable::FactorizedTable(
     MemoryManager* memoryManager, std::unique_ptr<FactorizedTableSchema> tableSchema)
     : memoryManager{memoryManager}, tableSchema{std::move(tableSchema)}, numTuples{0} {
@@ -92,8 +135,7 @@ FactorizedTable::FactorizedTable(
         inMemOverflowBuffer = std::make_unique<InMemOverflowBuffer>(memoryManager);
         numTuplesPerBlock =
             BufferPoolConstants::PAGE_256KB_SIZE / this->tableSchema->getNumBytesPerTuple();
-        flatTupleBlockCollection = std::make_unique<DataBlockCollection>(
-            this->tableSchema->getNumBytesPerTuple(), numTuplesPerBlock);
+        flatTupleBlockCollection = createFlatTupleBlockCollection();
         unflatTupleBlockCollection = std::make_unique<DataBlockCollection>();
     }
 }
@@ -113,6 +155,7 @@ void FactorizedTable::append(const std::vector<ValueVector*>& vectors) {
 }
 
 uint8_t* FactorizedTable::appendEmptyTuple() {
+    assert(!tableSchema->isColumnar());
     if (flatTupleBlockCollection->isEmpty() ||
         flatTupleBlockCollection->getBlocks().back()->freeSize <
             tableSchema->getNumBytesPerTuple()) {
@@ -130,6 +173,10 @@ void FactorizedTable::scan(std::vector<ValueVector*>& vectors, ft_tuple_idx_t tu
     uint64_t numTuplesToScan, std::vector<ft_col_idx_t>& colIdxesToScan) const {
     assert(tupleIdx + numTuplesToScan <= numTuples);
     assert(vectors.size() == colIdxesToScan.size());
+    if (tableSchema->isColumnar()) {
+        scanColumnar(vectors, tupleIdx, numTuplesToScan, colIdxesToScan);
+        return;
+    }
     std::unique_ptr<uint8_t*[]> tuplesToRead = std::make_unique<uint8_t*[]>(numTuplesToScan);
     for (auto i = 0u; i < numTuplesToScan; i++) {
         tuplesToRead[i] = getTuple(tupleIdx + i);
@@ -199,6 +246,18 @@ void FactorizedTable::merge(FactorizedTable& other) {
     numTuples += other.numTuples;
 }
 
+void FactorizedTable::mergeInOrder(FactorizedTable& other) {
+    assert(*tableSchema == *other.tableSchema);
+    if (other.numTuples == 0) {
+        return;
+    }
+    mergeMayContainNulls(other);
+    unflatTupleBlockCollection->append(std::move(other.unflatTupleBlockCollection));
+    flatTupleBlockCollection->mergeInOrder(*other.flatTupleBlockCollection);
+    inMemOverflowBuffer->merge(*other.inMemOverflowBuffer);
+    numTuples += other.numTuples;
+}
+
 bool FactorizedTable::hasUnflatCol() const {
     std::vector<ft_col_idx_t> colIdxes(tableSchema->getNumColumns());
     iota(colIdxes.begin(), colIdxes.end(), 0);
@@ -216,25 +275,38 @@ uint64_t FactorizedTable::getTotalNumFlatTuples() const {
 uint64_t FactorizedTable::getNumFlatTuples(ft_tuple_idx_t tupleIdx) const {
     std::unordered_map<uint32_t, bool> calculatedDataChunkPoses;
     uint64_t numFlatTuples = 1;
-    auto tupleBuffer = getTuple(tupleIdx);
     for (auto i = 0u; i < tableSchema->getNumColumns(); i++) {
         auto column = tableSchema->getColumn(i);
         if (!calculatedDataChunkPoses.contains(column->getDataChunkPos())) {
             calculatedDataChunkPoses[column->getDataChunkPos()] = true;
-            numFlatTuples *= column->isFlat() ? 1 : ((overflow_value_t*)tupleBuffer)->numElements;
+            numFlatTuples *=
+                column->isFlat() ? 1 : ((overflow_value_t*)getCellPtr(tupleIdx, i))->numElements;
         }
-        tupleBuffer += column->getNumBytes();
     }
     return numFlatTuples;
 }
 
 uint8_t* FactorizedTable::getTuple(ft_tuple_idx_t tupleIdx) const {
-    assert(tupleIdx < numTuples);
+    assert(tupleIdx < numTuples && !tableSchema->isColumnar());
     auto [blockIdx, tupleIdxInBlock] = getBlockIdxAndTupleIdxInBlock(tupleIdx);
     return flatTupleBlockCollection->getBlock(blockIdx)->getData() +
            tupleIdxInBlock * tableSchema->getNumBytesPerTuple();
 }
 
+uint8_t* FactorizedTable::getCellPtr(ft_tuple_idx_t tupleIdx, ft_col_idx_t colIdx) const {
+    assert(tupleIdx < numTuples);
+    auto [blockIdx, tupleIdxInBlock] = getBlockIdxAndTupleIdxInBlock(tupleIdx);
+    return getCellInBlock(
+        flatTupleBlockCollection->getBlock(blockIdx)->getData(), tupleIdxInBlock, colIdx);
+}
+
+uint8_t* FactorizedTable::getNullMapPtr(ft_tuple_idx_t tupleIdx) const {
+    assert(tupleIdx < numTuples);
+    auto [blockIdx, tupleIdxInBlock] = getBlockIdxAndTupleIdxInBlock(tupleIdx);
+    return getNullMapInBlock(
+        flatTupleBlockCollection->getBlock(blockIdx)->getData(), tupleIdxInBlock);
+}
+
 void FactorizedTable::updateFlatCell(
     uint8_t* tuplePtr, ft_col_idx_t colIdx, ValueVector* valueVector, uint32_t pos) {
     if (valueVector->isNull(pos)) {
@@ -247,12 +319,11 @@ void FactorizedTable::updateFlatCell(
 
 void FactorizedTable::copySingleValueToVector(ft_tuple_idx_t tupleIdx, ft_col_idx_t colIdx,
     ValueVector* valueVector, uint32_t posInVector) const {
-    auto tuple = getTuple(tupleIdx);
-    auto isNullInFT = isNonOverflowColNull(tuple + tableSchema->getNullMapOffset(), colIdx);
+    auto isNullInFT = isNonOverflowColNull(getNullMapPtr(tupleIdx), colIdx);
     valueVector->setNull(posInVector, isNullInFT);
     if (!isNullInFT) {
         ValueVectorUtils::copyNonNullDataWithSameTypeIntoPos(
-            *valueVector, posInVector, tuple + tableSchema->getColOffset(colIdx));
+            *valueVector, posInVector, getCellPtr(tupleIdx, colIdx));
     }
 }
 
@@ -286,17 +357,16 @@ void FactorizedTable::copyToInMemList(ft_col_idx_t colIdx,
     assert(column->isFlat() == true);
     auto numBytesPerValue =
         type.typeID == INTERNAL_ID ? sizeof(offset_t) : Types::getDataTypeSize(type);
-    auto colOffset = tableSchema->getColOffset(colIdx);
     auto listToFill = data + startElemPosInList * numBytesPerValue;
     for (auto i = 0u; i < tupleIdxesToRead.size(); i++) {
-        auto tuple = getTuple(tupleIdxesToRead[i]);
-        auto isNullInFT = isNonOverflowColNull(tuple + tableSchema->getNullMapOffset(), colIdx);
+        auto isNullInFT = isNonOverflowColNull(getNullMapPtr(tupleIdxesToRead[i]), colIdx);
         if (nullMask != nullptr) {
             nullMask->setNull(startElemPosInList + i, isNullInFT);
         }
         if (!isNullInFT) {
-            memcpy(listToFill, tuple + colOffset, numBytesPerValue);
-            copyOverflowIfNecessary(listToFill, tuple + colOffset, type, overflowFileOfInMemList);
+            auto cell = getCellPtr(tupleIdxesToRead[i], colIdx);
+            memcpy(listToFill, cell, numBytesPerValue);
+            copyOverflowIfNecessary(listToFill, cell, type, overflowFileOfInMemList);
         }
         listToFill += numBytesPerValue;
     }
@@ -317,12 +387,12 @@ int64_t FactorizedTable::findValueInFlatColumn(ft_col_idx_t colIdx, int64_t valu
         // numTuples % numTuplesPerBlock.
         auto numTuplesInCurBlock =
             blockIdx == (numBlocks - 1) ? numTuples % numTuplesPerBlock : numTuplesPerBlock;
-        auto tuplePtr = getTuple(tupleIdx);
+        auto cellPtr = getCellPtr(tupleIdx, colIdx);
         for (auto i = 0u; i < numTuplesInCurBlock; i++) {
-            if (memcmp(tuplePtr + tableSchema->getColOffset(colIdx), &value, numBytesForCol) == 0) {
+            if (memcmp(cellPtr, &value, numBytesForCol) == 0) {
                 return tupleIdx;
             }
-            tuplePtr += tableSchema->getNumBytesPerTuple();
+            cellPtr += getCellStride(colIdx);
             tupleIdx++;
         }
     }
@@ -331,8 +401,7 @@ int64_t FactorizedTable::findValueInFlatColumn(ft_col_idx_t colIdx, int64_t valu
 
 void FactorizedTable::clear() {
     numTuples = 0;
-    flatTupleBlockCollection = std::make_unique<DataBlockCollection>(
-        tableSchema->getNumBytesPerTuple(), numTuplesPerBlock);
+    flatTupleBlockCollection = createFlatTupleBlockCollection();
     unflatTupleBlockCollection = std::make_unique<DataBlockCollection>();
     inMemOverflowBuffer->resetBuffer();
 }
@@ -377,6 +446,19 @@ uint64_t FactorizedTable::computeNumTuplesToAppend(
     return numTuplesToAppend;
 }
 
+std::unique_ptr<DataBlockCollection> FactorizedTable::createFlatTupleBlockCollection() const {
+    std::vector<uint32_t> minipageValueSizes;
+    if (tableSchema->isColumnar()) {
+        // One minipage per column followed by one for the null maps of tuples.
+        for (auto i = 0u; i < tableSchema->getNumColumns(); i++) {
+            minipageValueSizes.push_back(tableSchema->getColumn(i)->getNumBytes());
+        }
+        minipageValueSizes.push_back(tableSchema->getNumBytesForNullMapPerTuple());
+    }
+    return std::make_unique<DataBlockCollection>(
+        tableSchema->getNumBytesPerTuple(), numTuplesPerBlock, std::move(minipageValueSizes));
+}
+
 std::vector<BlockAppendingInfo> FactorizedTable::allocateFlatTupleBlocks(
     uint64_t numTuplesToAppend) {
     auto numBytesPerTuple = tableSchema->getNumBytesPerTuple();
@@ -391,8 +473,7 @@ std::vector<BlockAppendingInfo> FactorizedTable::allocateFlatTupleBlocks(
         auto numTuplesToAppendInCurBlock =
             std::min(numTuplesToAppend, block->freeSize / numBytesPerTuple);
         appendingInfos.emplace_back(
-            block->getData() + BufferPoolConstants::PAGE_256KB_SIZE - block->freeSize,
-            numTuplesToAppendInCurBlock);
+            block->getData(), block->numTuples, numTuplesToAppendInCurBlock);
         block->freeSize -= numTuplesToAppendInCurBlock * numBytesPerTuple;
         block->numTuples += numTuplesToAppendInCurBlock;
         numTuplesToAppend -= numTuplesToAppendInCurBlock;
@@ -420,62 +501,71 @@ uint8_t* FactorizedTable::allocateUnflatTupleBlock(uint32_t numBytes) {
 void FactorizedTable::copyFlatVectorToFlatColumn(
     const ValueVector& vector, const BlockAppendingInfo& blockAppendInfo, ft_col_idx_t colIdx) {
     auto valuePositionInVectorToAppend = vector.state->selVector->selectedPositions[0];
-    auto colOffsetInDataBlock = tableSchema->getColOffset(colIdx);
-    auto dstDataPtr = blockAppendInfo.data;
+    auto dstDataPtr = getCellInBlock(blockAppendInfo.data, blockAppendInfo.blockOffset, colIdx);
+    auto dstNullMapPtr = getNullMapInBlock(blockAppendInfo.data, blockAppendInfo.blockOffset);
     for (auto i = 0u; i < blockAppendInfo.numTuplesToAppend; i++) {
         if (vector.isNull(valuePositionInVectorToAppend)) {
-            setNonOverflowColNull(dstDataPtr + tableSchema->getNullMapOffset(), colIdx);
+            setNonOverflowColNull(dstNullMapPtr, colIdx);
         } else {
-            ValueVectorUtils::copyNonNullDataWithSameTypeOutFromPos(vector,
-                valuePositionInVectorToAppend, dstDataPtr + colOffsetInDataBlock,
-                *inMemOverflowBuffer);
+            ValueVectorUtils::copyNonNullDataWithSameTypeOutFromPos(
+                vector, valuePositionInVectorToAppend, dstDataPtr, *inMemOverflowBuffer);
         }
-        dstDataPtr += tableSchema->getNumBytesPerTuple();
+        dstDataPtr += getCellStride(colIdx);
+        dstNullMapPtr += getNullMapStride();
     }
 }
 
 void FactorizedTable::copyUnflatVectorToFlatColumn(const ValueVector& vector,
     const BlockAppendingInfo& blockAppendInfo, uint64_t numAppendedTuples, ft_col_idx_t colIdx) {
-    auto byteOffsetOfColumnInTuple = tableSchema->getColOffset(colIdx);
-    auto dstTuple = blockAppendInfo.data;
+    auto dstDataPtr = getCellInBlock(blockAppendInfo.data, blockAppendInfo.blockOffset, colIdx);
+    auto dstNullMapPtr = getNullMapInBlock(blockAppendInfo.data, blockAppendInfo.blockOffset);
+    auto cellStride = getCellStride(colIdx);
+    auto nullMapStride = getNullMapStride();
     if (vector.state->selVector->isUnfiltered()) {
         if (vector.hasNoNullsGuarantee()) {
+            if (tableSchema->isColumnar() && isCopiedByMemcpy(vector.dataType)) {
+                // Values of the column are contiguous in both the vector and the block.
+                assert(cellStride == vector.getNumBytesPerValue());
+                memcpy(dstDataPtr, vector.getData() + numAppendedTuples * cellStride,
+                    blockAppendInfo.numTuplesToAppend * cellStride);
+                return;
+            }
             for (auto i = 0u; i < blockAppendInfo.numTuplesToAppend; i++) {
-                ValueVectorUtils::copyNonNullDataWithSameTypeOutFromPos(vector,
-                    numAppendedTuples + i, dstTuple + byteOffsetOfColumnInTuple,
-                    *inMemOverflowBuffer);
-                dstTuple += tableSchema->getNumBytesPerTuple();
+                ValueVectorUtils::copyNonNullDataWithSameTypeOutFromPos(
+                    vector, numAppendedTuples + i, dstDataPtr, *inMemOverflowBuffer);
+                dstDataPtr += cellStride;
             }
         } else {
             for (auto i = 0u; i < blockAppendInfo.numTuplesToAppend; i++) {
                 if (vector.isNull(numAppendedTuples + i)) {
-                    setNonOverflowColNull(dstTuple + tableSchema->getNullMapOffset(), colIdx);
+                    setNonOverflowColNull(dstNullMapPtr, colIdx);
                 } else {
-                    ValueVectorUtils::copyNonNullDataWithSameTypeOutFromPos(vector,
-                        numAppendedTuples + i, dstTuple + byteOffsetOfColumnInTuple,
-                        *inMemOverflowBuffer);
+                    ValueVectorUtils::copyNonNullDataWithSameTypeOutFromPos(
+                        vector, numAppendedTuples + i, dstDataPtr, *inMemOverflowBuffer);
                 }
-                dstTuple += tableSchema->getNumBytesPerTuple();
+                dstDataPtr += cellStride;
+                dstNullMapPtr += nullMapStride;
             }
         }
     } else {
         if (vector.hasNoNullsGuarantee()) {
             for (auto i = 0u; i < blockAppendInfo.numTuplesToAppend; i++) {
                 ValueVectorUtils::copyNonNullDataWithSameTypeOutFromPos(vector,
-                    vector.state->selVector->selectedPositions[numAppendedTuples + i],
-                    dstTuple + byteOffsetOfColumnInTuple, *inMemOverflowBuffer);
-                dstTuple += tableSchema->getNumBytesPerTuple();
+                    vector.state->selVector->selectedPositions[numAppendedTuples + i], dstDataPtr,
+                    *inMemOverflowBuffer);
+                dstDataPtr += cellStride;
             }
         } else {
             for (auto i = 0u; i < blockAppendInfo.numTuplesToAppend; i++) {
                 auto pos = vector.state->selVector->selectedPositions[numAppendedTuples + i];
                 if (vector.isNull(pos)) {
-                    setNonOverflowColNull(dstTuple + tableSchema->getNullMapOffset(), colIdx);
+                    setNonOverflowColNull(dstNullMapPtr, colIdx);
                 } else {
                     ValueVectorUtils::copyNonNullDataWithSameTypeOutFromPos(
-                        vector, pos, dstTuple + byteOffsetOfColumnInTuple, *inMemOverflowBuffer);
+                        vector, pos, dstDataPtr, *inMemOverflowBuffer);
                 }
-                dstTuple += tableSchema->getNumBytesPerTuple();
+                dstDataPtr += cellStride;
+                dstNullMapPtr += nullMapStride;
             }
         }
     }
@@ -488,10 +578,10 @@ void FactorizedTable::copyVectorToUnflatColumn(
     const ValueVector& vector, const BlockAppendingInfo& blockAppendInfo, ft_col_idx_t colIdx) {
     assert(!vector.state->isFlat());
     auto unflatTupleValue = appendVectorToUnflatTupleBlocks(vector, colIdx);
-    auto blockPtr = blockAppendInfo.data + tableSchema->getColOffset(colIdx);
+    auto blockPtr = getCellInBlock(blockAppendInfo.data, blockAppendInfo.blockOffset, colIdx);
     for (auto i = 0u; i < blockAppendInfo.numTuplesToAppend; i++) {
         memcpy(blockPtr, (uint8_t*)&unflatTupleValue, sizeof(overflow_value_t));
-        blockPtr += tableSchema->getNumBytesPerTuple();
+        blockPtr += getCellStride(colIdx);
     }
 }
 
@@ -557,10 +647,74 @@ overflow_value_t FactorizedTable::appendVectorToUnflatTupleBlocks(
     return overflow_value_t{numFlatTuplesInVector, overflowBlockBuffer};
 }
 
-void FactorizedTable::readUnflatCol(
-    uint8_t** tuplesToRead, ft_col_idx_t colIdx, ValueVector& vector) const {
-    auto vectorOverflowValue =
-        *(overflow_value_t*)(tuplesToRead[0] + tableSchema->getColOffset(colIdx));
+void FactorizedTable::scanColumnar(std::vector<ValueVector*>& vectors, ft_tuple_idx_t tupleIdx,
+    uint64_t numTuplesToScan, std::vector<ft_col_idx_t>& colIdxesToScan) const {
+    for (auto i = 0u; i < colIdxesToScan.size(); i++) {
+        ft_col_idx_t colIdx = colIdxesToScan[i];
+        if (!tableSchema->getColumn(colIdx)->isFlat()) {
+            assert(!vectors[i]->state->isFlat() && numTuplesToScan == 1);
+            readUnflatCol(*(overflow_value_t*)getCellPtr(tupleIdx, colIdx), colIdx, *vectors[i]);
+        } else if (vectors[i]->state->isFlat()) {
+            assert(numTuplesToScan == 1);
+            copySingleValueToVector(
+                tupleIdx, colIdx, vectors[i], vectors[i]->state->selVector->selectedPositions[0]);
+        } else {
+            readFlatColumnToUnflatVector(tupleIdx, numTuplesToScan, colIdx, *vectors[i]);
+        }
+    }
+}
+
+void FactorizedTable::readFlatColumnToUnflatVector(ft_tuple_idx_t tupleIdx,
+    uint64_t numTuplesToRead, ft_col_idx_t colIdx, ValueVector& vector) const {
+    vector.state->selVector->selectedSize = numTuplesToRead;
+    auto cellStride = getCellStride(colIdx);
+    auto nullMapStride = getNullMapStride();
+    auto canCopyBlockRanges =
+        vector.state->selVector->isUnfiltered() && isCopiedByMemcpy(vector.dataType);
+    if (hasNoNullGuarantee(colIdx)) {
+        vector.setAllNonNull();
+    }
+    auto numTuplesRead = 0ul;
+    while (numTuplesRead < numTuplesToRead) {
+        auto [blockIdx, blockOffset] = getBlockIdxAndTupleIdxInBlock(tupleIdx + numTuplesRead);
+        auto numTuplesToReadInBlock =
+            std::min(numTuplesToRead - numTuplesRead, (uint64_t)(numTuplesPerBlock - blockOffset));
+        auto blockData = flatTupleBlockCollection->getBlock(blockIdx)->getData();
+        auto srcData = getCellInBlock(blockData, blockOffset, colIdx);
+        if (hasNoNullGuarantee(colIdx)) {
+            if (canCopyBlockRanges) {
+                assert(cellStride == vector.getNumBytesPerValue());
+                memcpy(vector.getData() + numTuplesRead * cellStride, srcData,
+                    numTuplesToReadInBlock * cellStride);
+            } else {
+                for (auto i = 0u; i < numTuplesToReadInBlock; i++) {
+                    ValueVectorUtils::copyNonNullDataWithSameTypeIntoPos(vector,
+                        vector.state->selVector->selectedPositions[numTuplesRead + i], srcData);
+                    srcData += cellStride;
+                }
+            }
+        } else {
+            auto nullMap = getNullMapInBlock(blockData, blockOffset);
+            for (auto i = 0u; i < numTuplesToReadInBlock; i++) {
+                auto positionInVectorToWrite =
+                    vector.state->selVector->selectedPositions[numTuplesRead + i];
+                if (isNonOverflowColNull(nullMap, colIdx)) {
+                    vector.setNull(positionInVectorToWrite, true);
+                } else {
+                    vector.setNull(positionInVectorToWrite, false);
+                    ValueVectorUtils::copyNonNullDataWithSameTypeIntoPos(
+                        vector, positionInVectorToWrite, srcData);
+                }
+                srcData += cellStride;
+                nullMap += nullMapStride;
+            }
+        }
+        numTuplesRead += numTuplesToReadInBlock;
+    }
+}
+
+void FactorizedTable::readUnflatCol(const overflow_value_t& vectorOverflowValue,
+    ft_col_idx_t colIdx, ValueVector& vector) const {
     assert(vector.state->selVector->isUnfiltered());
     if (hasNoNullGuarantee(colIdx)) {
         vector.setAllNonNull();
@@ -674,8 +828,8 @@ void FactorizedTable::copyOverflowIfNecessary(
 }
 
 FlatTupleIterator::FlatTupleIterator(FactorizedTable& factorizedTable, std::vector<Value*> values)
-    : factorizedTable{factorizedTable}, numFlatTuples{0}, nextFlatTupleIdx{0},
-      nextTupleIdx{1}, values{std::move(values)} {
+    : factorizedTable{factorizedTable}, currentTupleNullMap{nullptr}, numFlatTuples{0},
+      nextFlatTupleIdx{0}, nextTupleIdx{1}, values{std::move(values)} {
     resetState();
     assert(this->values.size() == factorizedTable.tableSchema->getNumColumns());
 }
@@ -683,7 +837,7 @@ FlatTupleIterator::FlatTupleIterator(FactorizedTable& factorizedTable, std::vect
 void FlatTupleIterator::getNextFlatTuple() {
     // Go to the next tuple if we have iterated all the flat tuples of the current tuple.
     if (nextFlatTupleIdx >= numFlatTuples) {
-        currentTupleBuffer = factorizedTable.getTuple(nextTupleIdx);
+        updateCurrentTuple(nextTupleIdx);
         numFlatTuples = factorizedTable.getNumFlatTuples(nextTupleIdx);
         nextFlatTupleIdx = 0;
         updateNumElementsInDataChunk();
@@ -692,9 +846,9 @@ void FlatTupleIterator::getNextFlatTuple() {
     for (auto i = 0ul; i < factorizedTable.getTableSchema()->getNumColumns(); i++) {
         auto column = factorizedTable.getTableSchema()->getColumn(i);
         if (column->isFlat()) {
-            readFlatColToFlatTuple(i, currentTupleBuffer);
+            readFlatColToFlatTuple(i);
         } else {
-            readUnflatColToFlatTuple(i, currentTupleBuffer);
+            readUnflatColToFlatTuple(i);
         }
     }
     updateFlatTuplePositionsInDataChunk();
@@ -706,19 +860,27 @@ void FlatTupleIterator::resetState() {
     nextFlatTupleIdx = 0;
     nextTupleIdx = 1;
     if (factorizedTable.getNumTuples()) {
-        currentTupleBuffer = factorizedTable.getTuple(0);
+        updateCurrentTuple(0);
         numFlatTuples = factorizedTable.getNumFlatTuples(0);
         updateNumElementsInDataChunk();
         updateInvalidEntriesInFlatTuplePositionsInDataChunk();
     }
 }
 
-void FlatTupleIterator::readUnflatColToFlatTuple(ft_col_idx_t colIdx, uint8_t* valueBuffer) {
-    auto overflowValue =
-        (overflow_value_t*)(valueBuffer + factorizedTable.getTableSchema()->getColOffset(colIdx));
+void FlatTupleIterator::updateCurrentTuple(ft_tuple_idx_t tupleIdx) {
+    auto numColumns = factorizedTable.getTableSchema()->getNumColumns();
+    currentTupleCells.resize(numColumns);
+    for (auto i = 0u; i < numColumns; i++) {
+        currentTupleCells[i] = factorizedTable.getCellPtr(tupleIdx, i);
+    }
+    currentTupleNullMap = factorizedTable.getNullMapPtr(tupleIdx);
+}
+
+void FlatTupleIterator::readUnflatColToFlatTuple(ft_col_idx_t colIdx) {
+    auto overflowValue = (overflow_value_t*)currentTupleCells[colIdx];
     auto columnInFactorizedTable = factorizedTable.getTableSchema()->getColumn(colIdx);
     auto tupleSizeInOverflowBuffer = Types::getDataTypeSize(values[colIdx]->getDataType());
-    valueBuffer =
+    auto valueBuffer =
         overflowValue->value +
         tupleSizeInOverflowBuffer *
             flatTuplePositionsInDataChunk[columnInFactorizedTable->getDataChunkPos()].first;
@@ -731,13 +893,11 @@ void FlatTupleIterator::readUnflatColToFlatTuple(ft_col_idx_t colIdx, uint8_t* v
     }
 }
 
-void FlatTupleIterator::readFlatColToFlatTuple(ft_col_idx_t colIdx, uint8_t* valueBuffer) {
-    auto isNull = factorizedTable.isNonOverflowColNull(
-        valueBuffer + factorizedTable.getTableSchema()->getNullMapOffset(), colIdx);
+void FlatTupleIterator::readFlatColToFlatTuple(ft_col_idx_t colIdx) {
+    auto isNull = factorizedTable.isNonOverflowColNull(currentTupleNullMap, colIdx);
     values[colIdx]->setNull(isNull);
     if (!isNull) {
-        readValueBufferToValue(
-            colIdx, valueBuffer + factorizedTable.getTableSchema()->getColOffset(colIdx));
+        readValueBufferToValue(colIdx, currentTupleCells[colIdx]);
     }
 }
 
@@ -757,21 +917,17 @@ void FlatTupleIterator::updateInvalidEntriesInFlatTuplePositionsInDataChunk() {
 }
 
 void FlatTupleIterator::updateNumElementsInDataChunk() {
-    auto colOffsetInTupleBuffer = 0ul;
     for (auto i = 0u; i < factorizedTable.getTableSchema()->getNumColumns(); i++) {
         auto column = factorizedTable.getTableSchema()->getColumn(i);
         // If this is an unflat column, the number of elements is stored in the
         // overflow_value_t struct. Otherwise, the number of elements is 1.
         auto numElementsInDataChunk =
-            column->isFlat() ?
-                1 :
-                ((overflow_value_t*)(currentTupleBuffer + colOffsetInTupleBuffer))->numElements;
+            column->isFlat() ? 1 : ((overflow_value_t*)currentTupleCells[i])->numElements;
         if (column->getDataChunkPos() >= flatTuplePositionsInDataChunk.size()) {
             flatTuplePositionsInDataChunk.resize(column->getDataChunkPos() + 1);
         }
         flatTuplePositionsInDataChunk[column->getDataChunkPos()] =
             std::make_pair(0 /* nextIdxToReadInDataChunk */, numElementsInDataChunk);
-        colOffsetInTupleBuffer += column->getNumBytes();
     }
 }
 
@@ -247,8 +247,40 @@ void BufferManager::removeFilePagesFromFrames(BMFileHandle& fileHandle) {
 }
 
 void BufferManager::flushAllDirtyPagesInFrames(BMFileHandle& fileHandle) {
+    // Pages of the same page group are mapped to consecutive frames, so a run of consecutive dirty
+    // pages inside a page group can be written back with a single write. WAL pages are appended
+    // sequentially by a transaction, so this usually turns a commit into a few large writes.
+    page_idx_t startPageIdxOfRun = 0;
+    uint64_t numPagesInRun = 0;
     for (auto pageIdx = 0u; pageIdx < fileHandle.getNumPages(); ++pageIdx) {
-        removePageFromFrame(fileHandle, pageIdx, true /* flush */);
+        auto pageState = fileHandle.getPageState(pageIdx);
+        pageState->spinLock(pageState->getStateAndVersion());
+        auto isFirstPageInGroup = (pageIdx & StorageConstants::PAGE_IDX_IN_GROUP_MASK) == 0;
+        if (numPagesInRun > 0 && (!pageState->isDirty() || isFirstPageInGroup)) {
+            flushPagesAndRemoveFromFramesWithoutLock(fileHandle, startPageIdxOfRun, numPagesInRun);
+            numPagesInRun = 0;
+        }
+        if (pageState->isDirty()) {
+            startPageIdxOfRun = numPagesInRun == 0 ? pageIdx : startPageIdxOfRun;
+            numPagesInRun++;
+        } else {
+            releaseFrameForPage(fileHandle, pageIdx);
+            pageState->resetToEvicted();
+        }
+    }
+    if (numPagesInRun > 0) {
+        flushPagesAndRemoveFromFramesWithoutLock(fileHandle, startPageIdxOfRun, numPagesInRun);
+    }
+}
+
+// NOTE: We assume all pages in the range are locked and belong to the same page group.
+void BufferManager::flushPagesAndRemoveFromFramesWithoutLock(
+    BMFileHandle& fileHandle, page_idx_t startPageIdx, uint64_t numPages) {
+    FileUtils::writeToFile(fileHandle.getFileInfo(), getFrame(fileHandle, startPageIdx),
+        numPages * fileHandle.getPageSize(), startPageIdx * fileHandle.getPageSize());
+    for (auto pageIdx = startPageIdx; pageIdx < startPageIdx + numPages; ++pageIdx) {
+        releaseFrameForPage(fileHandle, pageIdx);
+        fileHandle.getPageState(pageIdx)->resetToEvicted();
     }
 }
 
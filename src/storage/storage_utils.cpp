@@ -66,6 +66,11 @@ std::string StorageUtils::getAdjColumnFName(const std::string& directory,
 }
 
 std::unique_ptr<FileInfo> StorageUtils::getFileInfoForReadWrite(
+    const std::string& directory, StorageStructureID storageStructureID) {
+    return FileUtils::openFile(getStorageStructureFName(directory, storageStructureID), O_RDWR);
+}
+
+std::string StorageUtils::getStorageStructureFName(
     const std::string& directory, StorageStructureID storageStructureID) {
     std::string fName;
     switch (storageStructureID.storageStructureType) {
@@ -84,10 +89,10 @@ std::unique_ptr<FileInfo> StorageUtils::getFileInfoForReadWrite(
     } break;
     default: {
         throw RuntimeException("Unsupported StorageStructureID in "
-                               "StorageUtils::getFileInfoFromStorageStructureID.");
+                               "StorageUtils::getStorageStructureFName.");
     }
     }
-    return FileUtils::openFile(fName, O_RDWR);
+    return fName;
 }
 
 std::string StorageUtils::getColumnFName(
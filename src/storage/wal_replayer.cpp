@@ -1,5 +1,6 @@
 #include "storage/wal_replayer.h"
 
+#include "storage/copier/copy_task.h"
 #include "storage/storage_manager.h"
 #include "storage/storage_utils.h"
 #include "storage/wal_replayer_utils.h"
@@ -10,7 +11,8 @@ using namespace kuzu::common;
 namespace kuzu {
 namespace storage {
 
-WALReplayer::WALReplayer(WAL* wal) : isRecovering{true}, isCheckpoint{true}, wal{wal} {
+WALReplayer::WALReplayer(WAL* wal, TaskScheduler* taskScheduler)
+    : isRecovering{true}, isCheckpoint{true}, wal{wal}, taskScheduler{taskScheduler} {
     init();
 }
 
@@ -18,14 +20,15 @@ WALReplayer::WALReplayer(WAL* wal, StorageManager* storageManager, MemoryManager
     Catalog* catalog, bool isCheckpoint)
     : isRecovering{false}, isCheckpoint{isCheckpoint}, storageManager{storageManager},
       bufferManager{memoryManager->getBufferManager()},
-      memoryManager{memoryManager}, wal{wal}, catalog{catalog} {
+      memoryManager{memoryManager}, wal{wal}, catalog{catalog}, taskScheduler{nullptr} {
     init();
 }
 
 void WALReplayer::init() {
     logger = LoggerUtils::getLogger(LoggerConstants::LoggerEnum::STORAGE);
     walFileHandle = wal->fileHandle;
-    pageBuffer = std::make_unique<uint8_t[]>(BufferPoolConstants::PAGE_4KB_SIZE);
+    pageBuffer = std::make_unique<uint8_t[]>(
+        StorageConstants::MAX_NUM_PAGES_PER_CHECKPOINT_WRITE * BufferPoolConstants::PAGE_4KB_SIZE);
 }
 
 void WALReplayer::replay() {
@@ -46,8 +49,25 @@ void WALReplayer::replay() {
     WALRecord walRecord;
     while (walIterator->hasNextRecord()) {
         walIterator->getNextRecord(walRecord);
-        replayWALRecord(walRecord);
+        switch (walRecord.recordType) {
+        case WALRecordType::PAGE_UPDATE_OR_INSERT_RECORD: {
+            pageUpdateOrInsertRecordsToReplay.push_back(walRecord.pageInsertOrUpdateRecord);
+        } break;
+        case WALRecordType::COMMIT_RECORD:
+        case WALRecordType::OVERFLOW_FILE_NEXT_BYTE_POS_RECORD: {
+            // These records neither read nor write db files, so buffered page records can be
+            // replayed after them.
+            replayWALRecord(walRecord);
+        } break;
+        default: {
+            // Other records may create, replace or remove the db files that the buffered page
+            // records refer to, so we first replay the buffered page records to keep log order.
+            replayPageUpdateOrInsertRecords();
+            replayWALRecord(walRecord);
+        }
+        }
     }
+    replayPageUpdateOrInsertRecords();
 
     // We next perform an in-memory checkpointing or rolling back of nodeTables.
     for (auto nodeTableID : wal->updatedNodeTables) {
@@ -72,26 +92,8 @@ void WALReplayer::replay() {
 void WALReplayer::replayWALRecord(WALRecord& walRecord) {
     switch (walRecord.recordType) {
     case WALRecordType::PAGE_UPDATE_OR_INSERT_RECORD: {
-        // 1. As the first step we copy over the page on disk, regardless of if we are recovering
-        // (and checkpointing) or checkpointing while during regular execution.
-        auto storageStructureID = walRecord.pageInsertOrUpdateRecord.storageStructureID;
-        std::unique_ptr<FileInfo> fileInfoOfStorageStructure =
-            StorageUtils::getFileInfoForReadWrite(wal->getDirectory(), storageStructureID);
-        if (isCheckpoint) {
-            walFileHandle->readPage(
-                pageBuffer.get(), walRecord.pageInsertOrUpdateRecord.pageIdxInWAL);
-            FileUtils::writeToFile(fileInfoOfStorageStructure.get(), pageBuffer.get(),
-                BufferPoolConstants::PAGE_4KB_SIZE,
-                walRecord.pageInsertOrUpdateRecord.pageIdxInOriginalFile *
-                    BufferPoolConstants::PAGE_4KB_SIZE);
-        }
-        if (!isRecovering) {
-            // 2: If we are not recovering, we do any in-memory checkpointing or rolling back work
-            // to make sure that the system's in-memory structures are consistent with what is on
-            // disk. For example, we update the BM's image of the pages or InMemDiskArrays used by
-            // lists or the WALVersion pageIdxs of pages for VersionedFileHandles.
-            checkpointOrRollbackVersionedFileHandleAndBufferManager(walRecord, storageStructureID);
-        }
+        pageUpdateOrInsertRecordsToReplay.push_back(walRecord.pageInsertOrUpdateRecord);
+        replayPageUpdateOrInsertRecords();
     } break;
     case WALRecordType::TABLE_STATISTICS_RECORD: {
         if (isCheckpoint) {
@@ -419,6 +421,113 @@ void WALReplayer::replayWALRecord(WALRecord& walRecord) {
     }
 }
 
+void WALReplayer::replayPageUpdateOrInsertRecords() {
+    if (pageUpdateOrInsertRecordsToReplay.empty()) {
+        return;
+    }
+    if (isCheckpoint) {
+        // 1. As the first step we copy over the pages on disk, regardless of if we are recovering
+        // (and checkpointing) or checkpointing while during regular execution. We group the
+        // records by the file they update, so that each file is opened only once.
+        std::map<std::string, std::vector<PageUpdateOrInsertRecord>> recordsPerFile;
+        for (auto& record : pageUpdateOrInsertRecordsToReplay) {
+            recordsPerFile[StorageUtils::getStorageStructureFName(
+                               wal->getDirectory(), record.storageStructureID)]
+                .push_back(record);
+        }
+        if (isRecovering && taskScheduler != nullptr && recordsPerFile.size() > 1) {
+            // During recovery there are no in-memory structures to update, so files do not
+            // depend on each other and we copy the pages of different files in parallel.
+            for (auto& fNameAndRecords : recordsPerFile) {
+                taskScheduler->scheduleTask(CopyTaskFactory::createCopyTask([&]() {
+                    auto buffer = std::make_unique<uint8_t[]>(
+                        StorageConstants::MAX_NUM_PAGES_PER_CHECKPOINT_WRITE *
+                        BufferPoolConstants::PAGE_4KB_SIZE);
+                    checkpointPageUpdateOrInsertRecordsOfFile(
+                        fNameAndRecords.first, fNameAndRecords.second, buffer.get());
+                }));
+            }
+            taskScheduler->waitAllTasksToCompleteOrError();
+        } else {
+            for (auto& [fName, records] : recordsPerFile) {
+                checkpointPageUpdateOrInsertRecordsOfFile(fName, records, pageBuffer.get());
+            }
+        }
+    } else if (!isRecovering) {
+        for (auto& record : pageUpdateOrInsertRecordsToReplay) {
+            checkpointOrRollbackVersionedFileHandleAndBufferManager(record, nullptr /* walPage */);
+        }
+    }
+    pageUpdateOrInsertRecordsToReplay.clear();
+}
+
+void WALReplayer::checkpointPageUpdateOrInsertRecordsOfFile(const std::string& fName,
+    std::vector<PageUpdateOrInsertRecord>& records, uint8_t* buffer) {
+    // The sort is stable, so if a page has been logged more than once, its last logged version is
+    // the last one among the records of that page and is the one we keep.
+    std::stable_sort(records.begin(), records.end(),
+        [](const PageUpdateOrInsertRecord& left, const PageUpdateOrInsertRecord& right) {
+            return left.pageIdxInOriginalFile < right.pageIdxInOriginalFile;
+        });
+    auto numRecords = 0u;
+    for (auto i = 0u; i < records.size(); ++i) {
+        if (numRecords > 0 &&
+            records[numRecords - 1].pageIdxInOriginalFile == records[i].pageIdxInOriginalFile) {
+            records[numRecords - 1] = records[i];
+        } else {
+            records[numRecords++] = records[i];
+        }
+    }
+    records.resize(numRecords);
+    auto fileInfo = FileUtils::openFile(fName, O_RDWR);
+    auto startIdx = 0u;
+    while (startIdx < records.size()) {
+        // Find the run of records that update consecutive pages of the file.
+        auto endIdx = startIdx + 1;
+        while (endIdx < records.size() &&
+               endIdx - startIdx < StorageConstants::MAX_NUM_PAGES_PER_CHECKPOINT_WRITE &&
+               records[endIdx].pageIdxInOriginalFile ==
+                   records[endIdx - 1].pageIdxInOriginalFile + 1) {
+            endIdx++;
+        }
+        auto numPagesInRun = endIdx - startIdx;
+        readWALPagesIntoBuffer(&records[startIdx], numPagesInRun, buffer);
+        FileUtils::writeToFile(fileInfo.get(), buffer,
+            numPagesInRun * BufferPoolConstants::PAGE_4KB_SIZE,
+            records[startIdx].pageIdxInOriginalFile * BufferPoolConstants::PAGE_4KB_SIZE);
+        if (!isRecovering) {
+            // 2: If we are not recovering, we do any in-memory checkpointing or rolling back work
+            // to make sure that the system's in-memory structures are consistent with what is on
+            // disk. For example, we update the BM's image of the pages or InMemDiskArrays used by
+            // lists or the WALVersion pageIdxs of pages for VersionedFileHandles.
+            for (auto i = 0u; i < numPagesInRun; ++i) {
+                checkpointOrRollbackVersionedFileHandleAndBufferManager(
+                    records[startIdx + i], buffer + i * BufferPoolConstants::PAGE_4KB_SIZE);
+            }
+        }
+        startIdx = endIdx;
+    }
+}
+
+void WALReplayer::readWALPagesIntoBuffer(
+    const PageUpdateOrInsertRecord* records, uint64_t numRecords, uint8_t* buffer) {
+    // WAL pages of consecutive db file pages are often themselves consecutive in the WAL, in which
+    // case we read them with a single read.
+    auto startIdx = 0u;
+    while (startIdx < numRecords) {
+        auto endIdx = startIdx + 1;
+        while (endIdx < numRecords &&
+               records[endIdx].pageIdxInWAL == records[endIdx - 1].pageIdxInWAL + 1) {
+            endIdx++;
+        }
+        FileUtils::readFromFile(walFileHandle->getFileInfo(),
+            buffer + startIdx * BufferPoolConstants::PAGE_4KB_SIZE,
+            (endIdx - startIdx) * BufferPoolConstants::PAGE_4KB_SIZE,
+            records[startIdx].pageIdxInWAL * BufferPoolConstants::PAGE_4KB_SIZE);
+        startIdx = endIdx;
+    }
+}
+
 void WALReplayer::truncateFileIfInsertion(
     BMFileHandle* fileHandle, const PageUpdateOrInsertRecord& pageInsertOrUpdateRecord) {
     if (pageInsertOrUpdateRecord.isInsert) {
@@ -439,20 +548,19 @@ void WALReplayer::truncateFileIfInsertion(
 }
 
 void WALReplayer::checkpointOrRollbackVersionedFileHandleAndBufferManager(
-    const WALRecord& walRecord, const StorageStructureID& storageStructureID) {
-    BMFileHandle* fileHandle =
-        getVersionedFileHandleIfWALVersionAndBMShouldBeCleared(storageStructureID);
+    const PageUpdateOrInsertRecord& pageInsertOrUpdateRecord, uint8_t* walPage) {
+    BMFileHandle* fileHandle = getVersionedFileHandleIfWALVersionAndBMShouldBeCleared(
+        pageInsertOrUpdateRecord.storageStructureID);
     if (fileHandle) {
-        fileHandle->clearWALPageIdxIfNecessary(
-            walRecord.pageInsertOrUpdateRecord.pageIdxInOriginalFile);
+        fileHandle->clearWALPageIdxIfNecessary(pageInsertOrUpdateRecord.pageIdxInOriginalFile);
         if (isCheckpoint) {
             // Update the page in buffer manager if it is in a frame. Note that we assume
-            // that the pageBuffer currently contains the contents of the WALVersion, so the
-            // caller needs to make sure that this assumption holds.
-            bufferManager->updateFrameIfPageIsInFrameWithoutLock(*fileHandle, pageBuffer.get(),
-                walRecord.pageInsertOrUpdateRecord.pageIdxInOriginalFile);
+            // that walPage contains the contents of the WALVersion, so the caller needs to make
+            // sure that this assumption holds.
+            bufferManager->updateFrameIfPageIsInFrameWithoutLock(
+                *fileHandle, walPage, pageInsertOrUpdateRecord.pageIdxInOriginalFile);
         } else {
-            truncateFileIfInsertion(fileHandle, walRecord.pageInsertOrUpdateRecord);
+            truncateFileIfInsertion(fileHandle, pageInsertOrUpdateRecord);
         }
     }
 }
@@ -7,19 +7,33 @@ using namespace kuzu::common;
 namespace kuzu {
 namespace transaction {
 
-std::unique_ptr<Transaction> TransactionManager::beginWriteTransaction() {
-    // We obtain the lock for starting new transactions. In case this cannot be obtained this
-    // ensures calls to other public functions is not restricted.
-    lock_t newTransactionLck{mtxForStartingNewTransactions};
-    lock_t publicFunctionLck{mtxForSerializingPublicFunctionCalls};
-    if (hasActiveWriteTransactionNoLock()) {
-        throw TransactionManagerException(
-            "Cannot start a new write transaction in the system. Only one write transaction at a "
-            "time is allowed in the system.");
+std::unique_ptr<Transaction> TransactionManager::beginWriteTransaction(
+    uint64_t waitTimeoutInMicros) {
+    auto deadline =
+        std::chrono::steady_clock::now() + std::chrono::microseconds(waitTimeoutInMicros);
+    while (true) {
+        // We obtain the lock for starting new transactions. In case this cannot be obtained this
+        // ensures calls to other public functions is not restricted.
+        lock_t newTransactionLck{mtxForStartingNewTransactions};
+        lock_t publicFunctionLck{mtxForSerializingPublicFunctionCalls};
+        if (!hasActiveWriteTransactionNoLock()) {
+            auto transaction =
+                std::make_unique<Transaction>(TransactionType::WRITE, ++lastTransactionID);
+            activeWriteTransactionID = lastTransactionID;
+            return transaction;
+        }
+        // The active write transaction needs the lock for starting new transactions to commit, so
+        // we release it while waiting. Once the active write transaction leaves, we start over
+        // and acquire both locks again in the same order.
+        newTransactionLck.unlock();
+        if (waitTimeoutInMicros == 0 ||
+            !cvForActiveWriteTransactionToLeave.wait_until(
+                publicFunctionLck, deadline, [&] { return !hasActiveWriteTransactionNoLock(); })) {
+            throw TransactionManagerException(
+                "Cannot start a new write transaction in the system. Only one write transaction at "
+                "a time is allowed in the system.");
+        }
     }
-    auto transaction = std::make_unique<Transaction>(TransactionType::WRITE, ++lastTransactionID);
-    activeWriteTransactionID = lastTransactionID;
-    return transaction;
 }
 
 std::unique_ptr<Transaction> TransactionManager::beginReadOnlyTransaction() {
@@ -47,6 +61,9 @@ void TransactionManager::manuallyClearActiveWriteTransaction(Transaction* transa
 void TransactionManager::commitOrRollbackNoLock(Transaction* transaction, bool isCommit) {
     if (transaction->isReadOnly()) {
         activeReadOnlyTransactionIDs.erase(transaction->getID());
+        if (activeReadOnlyTransactionIDs.empty()) {
+            cvForReadOnlyTransactionsToLeave.notify_all();
+        }
         return;
     }
     assertActiveWriteTransationIsCorrectNoLock(transaction);
@@ -85,22 +102,13 @@ void TransactionManager::allowReceivingNewTransactions() {
 void TransactionManager::stopNewTransactionsAndWaitUntilAllReadTransactionsLeave() {
     mtxForStartingNewTransactions.lock();
     lock_t lck{mtxForSerializingPublicFunctionCalls};
-    uint64_t numTimesWaited = 0;
-    while (true) {
-        if (!activeReadOnlyTransactionIDs.empty()) {
-            numTimesWaited++;
-            if (numTimesWaited * THREAD_SLEEP_TIME_WHEN_WAITING_IN_MICROS >
-                checkPointWaitTimeoutForTransactionsToLeaveInMicros) {
-                throw TransactionManagerException(
-                    "Timeout waiting for read transactions to leave the system before committing "
-                    "and checkpointing a write transaction. If you have an open read transaction "
-                    "close and try again.");
-            }
-            std::this_thread::sleep_for(
-                std::chrono::microseconds(THREAD_SLEEP_TIME_WHEN_WAITING_IN_MICROS));
-        } else {
-            break;
-        }
+    if (!cvForReadOnlyTransactionsToLeave.wait_for(lck,
+            std::chrono::microseconds(checkPointWaitTimeoutForTransactionsToLeaveInMicros),
+            [&] { return activeReadOnlyTransactionIDs.empty(); })) {
+        throw TransactionManagerException(
+            "Timeout waiting for read transactions to leave the system before committing "
+            "and checkpointing a write transaction. If you have an open read transaction "
+            "close and try again.");
     }
 }
 
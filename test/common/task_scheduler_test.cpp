@@ -0,0 +1,215 @@
+#include <chrono>
+#include <thread>
+
+#include "common/exception.h"
+#include "common/task_system/task_scheduler.h"
+#include "gtest/gtest.h"
+
+using namespace kuzu::common;
+using ::testing::Test;
+
+// Blocking tasks release themselves and waits give up after this time, so that a failing test
+// does not hang.
+static constexpr auto TEST_TIMEOUT = std::chrono::seconds(10);
+
+class CountingTask : public Task {
+public:
+    CountingTask(uint64_t maxNumThreads, std::atomic<uint64_t>& counter, bool throwException)
+        : Task{maxNumThreads}, counter{counter}, throwException{throwException} {}
+
+    void run() override {
+        counter++;
+        if (throwException) {
+            throw RuntimeException("Task failed.");
+        }
+    }
+
+private:
+    std::atomic<uint64_t>& counter;
+    bool throwException;
+};
+
+// Each thread of the task blocks in run() until the task is released.
+class BlockingTask : public Task {
+public:
+    explicit BlockingTask(uint64_t maxNumThreads)
+        : Task{maxNumThreads}, numThreadsStarted{0}, released{false} {}
+
+    void run() override {
+        numThreadsStarted++;
+        auto deadline = std::chrono::steady_clock::now() + TEST_TIMEOUT;
+        while (!released.load() && std::chrono::steady_clock::now() < deadline) {
+            std::this_thread::sleep_for(std::chrono::microseconds(100));
+        }
+    }
+
+    inline void release() { released.store(true); }
+
+public:
+    std::atomic<uint64_t> numThreadsStarted;
+
+private:
+    std::atomic<bool> released;
+};
+
+// Each thread of the task processes morsels until the task is released, and yields between
+// morsels when it is asked to.
+class MorselTask : public Task {
+public:
+    explicit MorselTask(uint64_t maxNumThreads)
+        : Task{maxNumThreads}, numYields{0}, released{false} {}
+
+    void run() override {
+        auto deadline = std::chrono::steady_clock::now() + TEST_TIMEOUT;
+        while (!released.load() && std::chrono::steady_clock::now() < deadline) {
+            if (yieldThreadIfRequested()) {
+                numYields++;
+                return;
+            }
+            std::this_thread::sleep_for(std::chrono::microseconds(100));
+        }
+    }
+
+    bool canYield() const override { return true; }
+
+    inline void release() { released.store(true); }
+
+public:
+    std::atomic<uint64_t> numYields;
+
+private:
+    std::atomic<bool> released;
+};
+
+// Returns false if the condition does not hold before the test timeout.
+template<typename Condition>
+static bool waitUntil(Condition condition) {
+    auto deadline = std::chrono::steady_clock::now() + TEST_TIMEOUT;
+    while (!condition()) {
+        if (std::chrono::steady_clock::now() >= deadline) {
+            return false;
+        }
+        std::this_thread::sleep_for(std::chrono::microseconds(100));
+    }
+    return true;
+}
+
+static bool waitUntilNumThreadsStarted(
+    const std::vector<std::shared_ptr<BlockingTask>>& tasks, uint64_t numThreads) {
+    return waitUntil([&] {
+        auto numThreadsStarted = 0u;
+        for (auto& task : tasks) {
+            numThreadsStarted += task->numThreadsStarted.load();
+        }
+        return numThreadsStarted >= numThreads;
+    });
+}
+
+class TaskSchedulerTest : public Test {
+protected:
+    void SetUp() override {
+        LoggerUtils::createLogger(LoggerConstants::LoggerEnum::PROCESSOR);
+        taskScheduler = std::make_unique<TaskScheduler>(4 /* numThreads */);
+    }
+
+    void TearDown() override {
+        taskScheduler.reset();
+        LoggerUtils::dropLogger(LoggerConstants::LoggerEnum::PROCESSOR);
+    }
+
+public:
+    std::unique_ptr<TaskScheduler> taskScheduler;
+};
+
+TEST_F(TaskSchedulerTest, ScheduleTaskAndWait) {
+    std::atomic<uint64_t> counter{0};
+    auto task = std::make_shared<CountingTask>(4, counter, false /* throwException */);
+    for (auto i = 0u; i < 3; ++i) {
+        task->addChildTask(
+            std::make_unique<CountingTask>(1, counter, false /* throwException */));
+    }
+    taskScheduler->scheduleTaskAndWaitOrError(task, nullptr /* context */);
+    ASSERT_TRUE(task->isCompletedSuccessfully());
+    ASSERT_GE(counter.load(), 4);
+    ASSERT_TRUE(taskScheduler->isTaskQueueEmpty());
+}
+
+TEST_F(TaskSchedulerTest, ScheduleTaskAndWaitRethrows) {
+    std::atomic<uint64_t> counter{0};
+    auto task = std::make_shared<CountingTask>(1, counter, true /* throwException */);
+    try {
+        taskScheduler->scheduleTaskAndWaitOrError(task, nullptr /* context */);
+        FAIL();
+    } catch (RuntimeException& e) {}
+    ASSERT_TRUE(taskScheduler->isTaskQueueEmpty());
+}
+
+TEST_F(TaskSchedulerTest, WaitAllTasksToComplete) {
+    std::atomic<uint64_t> counter{0};
+    for (auto i = 0u; i < 100; ++i) {
+        taskScheduler->scheduleTask(
+            std::make_shared<CountingTask>(1, counter, false /* throwException */));
+        taskScheduler->waitUntilEnoughTasksFinish(8 /* minimumNumTasksToScheduleMore */);
+    }
+    taskScheduler->waitAllTasksToCompleteOrError();
+    ASSERT_EQ(counter.load(), 100);
+    ASSERT_TRUE(taskScheduler->isTaskQueueEmpty());
+}
+
+TEST_F(TaskSchedulerTest, SpreadFreedWorkersOverWaitingTasks) {
+    auto longTask = std::make_shared<BlockingTask>(4);
+    taskScheduler->scheduleTask(longTask);
+    ASSERT_TRUE(waitUntilNumThreadsStarted({longTask}, 4));
+    // Both tasks could take all workers. They are scheduled while all workers are busy.
+    auto task1 = std::make_shared<BlockingTask>(4);
+    auto task2 = std::make_shared<BlockingTask>(4);
+    taskScheduler->scheduleTask(task1);
+    taskScheduler->scheduleTask(task2);
+    longTask->release();
+    // The workers have settled once all of them left the long task and registered to the waiting
+    // tasks. They stay blocked there, so the split cannot change before the tasks are released.
+    ASSERT_TRUE(waitUntil([&] { return longTask->isCompleted(); }));
+    ASSERT_TRUE(waitUntilNumThreadsStarted({task1, task2}, 4));
+    ASSERT_EQ(task1->getNumThreadsRegistered() + task2->getNumThreadsRegistered(), 4);
+    ASSERT_EQ(task1->numThreadsStarted.load(), 2);
+    ASSERT_EQ(task2->numThreadsStarted.load(), 2);
+    task1->release();
+    task2->release();
+    taskScheduler->waitAllTasksToCompleteOrError();
+    ASSERT_TRUE(longTask->isCompletedSuccessfully());
+    ASSERT_TRUE(task1->isCompletedSuccessfully());
+    ASSERT_TRUE(task2->isCompletedSuccessfully());
+}
+
+TEST_F(TaskSchedulerTest, HigherPriorityTaskMakesThreadsYield) {
+    auto batchTask = std::make_shared<MorselTask>(4);
+    taskScheduler->scheduleTask(batchTask);
+    ASSERT_TRUE(waitUntil([&] { return batchTask->getNumThreadsRegistered() == 4; }));
+    // All workers are busy with the batch task, which would only finish once it is released.
+    std::atomic<uint64_t> counter{0};
+    auto interactiveTask = std::make_shared<CountingTask>(1, counter, false /* throwException */);
+    interactiveTask->setPriority(1);
+    taskScheduler->scheduleTask(interactiveTask);
+    ASSERT_TRUE(waitUntil([&] { return interactiveTask->isCompleted(); }));
+    ASSERT_TRUE(interactiveTask->isCompletedSuccessfully());
+    ASSERT_EQ(counter.load(), 1);
+    ASSERT_FALSE(batchTask->isCompleted());
+    ASSERT_GE(batchTask->numYields.load(), 1);
+    batchTask->release();
+    taskScheduler->waitAllTasksToCompleteOrError();
+    ASSERT_TRUE(batchTask->isCompletedSuccessfully());
+}
+
+TEST_F(TaskSchedulerTest, EqualPriorityTaskDoesNotMakeThreadsYield) {
+    auto batchTask = std::make_shared<MorselTask>(4);
+    taskScheduler->scheduleTask(batchTask);
+    ASSERT_TRUE(waitUntil([&] { return batchTask->getNumThreadsRegistered() == 4; }));
+    std::atomic<uint64_t> counter{0};
+    auto task = std::make_shared<CountingTask>(1, counter, false /* throwException */);
+    taskScheduler->scheduleTask(task);
+    batchTask->release();
+    taskScheduler->waitAllTasksToCompleteOrError();
+    ASSERT_EQ(batchTask->numYields.load(), 0);
+    ASSERT_TRUE(batchTask->isCompletedSuccessfully());
+    ASSERT_TRUE(task->isCompletedSuccessfully());
+}
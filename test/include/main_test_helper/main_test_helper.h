@@ -28,6 +28,16 @@ public:
         ASSERT_FALSE(result->hasNext());
     }
 
+    // Executes the query with the plan whose joins are encoded as encodedJoin.
+    static std::unique_ptr<QueryResult> queryWithEncodedJoin(
+        Connection* conn, const std::string& query, const std::string& encodedJoin) {
+        return conn->query(query, encodedJoin);
+    }
+
+    static nlohmann::json& getPlanInJson(QueryResult& result) {
+        return result.getQuerySummary()->printPlanToJson();
+    }
+
     static void executeLongRunningQuery(Connection* conn) {
         auto result = conn->query("MATCH (a:person)-[:knows*1..28]->(b:person) RETURN COUNT(*)");
         ASSERT_FALSE(result->isSuccess());
@@ -151,3 +151,122 @@ TEST_F(ApiTest, TimeOut) {
     ASSERT_FALSE(result->isSuccess());
     ASSERT_EQ(result->getErrorMessage(), "Interrupted.");
 }
+
+TEST_F(ApiTest, PlanCache) {
+    auto numHits = database->getNumPlanCacheHits();
+    auto numMisses = database->getNumPlanCacheMisses();
+    ApiTest::assertMatchPersonCountStar(conn.get());
+    ASSERT_EQ(numMisses + 1, database->getNumPlanCacheMisses());
+    // Queries differing only in whitespaces share the same cached plan.
+    auto result = conn->query("  MATCH (a:person)\n\tRETURN   COUNT(*)");
+    ASSERT_EQ(result->getNext()->getValue(0)->getValue<int64_t>(), 8);
+    ASSERT_EQ(numHits + 1, database->getNumPlanCacheHits());
+    ASSERT_EQ(numMisses + 1, database->getNumPlanCacheMisses());
+    // Whitespaces inside string literals are not normalized.
+    result = conn->query("MATCH (a:person) WHERE a.fName = 'Alice  ' RETURN COUNT(*)");
+    ASSERT_EQ(result->getNext()->getValue(0)->getValue<int64_t>(), 0);
+    ASSERT_EQ(numMisses + 2, database->getNumPlanCacheMisses());
+    // Small changes to table statistics keep cached plans valid.
+    ASSERT_TRUE(conn->query("CREATE (:person {ID: 100})")->isSuccess());
+    ASSERT_EQ(numMisses + 3, database->getNumPlanCacheMisses());
+    result = conn->query("MATCH (a:person) RETURN COUNT(*)");
+    ASSERT_EQ(result->getNext()->getValue(0)->getValue<int64_t>(), 9);
+    ASSERT_EQ(numHits + 2, database->getNumPlanCacheHits());
+    // Committing catalog updates invalidates cached plans.
+    ASSERT_TRUE(
+        conn->query("CREATE NODE TABLE plan_cache_test(ID INT64, PRIMARY KEY(ID))")->isSuccess());
+    ASSERT_EQ(numMisses + 4, database->getNumPlanCacheMisses());
+    result = conn->query("MATCH (a:person) RETURN COUNT(*)");
+    ASSERT_EQ(result->getNext()->getValue(0)->getValue<int64_t>(), 9);
+    ASSERT_EQ(numHits + 2, database->getNumPlanCacheHits());
+    ASSERT_EQ(numMisses + 5, database->getNumPlanCacheMisses());
+    // Growing a table by more than PLAN_CACHE_STATISTICS_CHANGE_RATIO invalidates cached plans.
+    auto preparedStatement = conn->prepare("CREATE (:person {ID: $1})");
+    for (auto i = 0; i < 10; ++i) {
+        result = conn->execute(
+            preparedStatement.get(), std::make_pair(std::string("1"), (int64_t)(101 + i)));
+        ASSERT_TRUE(result->isSuccess());
+    }
+    ASSERT_EQ(numMisses + 6, database->getNumPlanCacheMisses());
+    result = conn->query("MATCH (a:person) RETURN COUNT(*)");
+    ASSERT_EQ(result->getNext()->getValue(0)->getValue<int64_t>(), 19);
+    ASSERT_EQ(numHits + 2, database->getNumPlanCacheHits());
+    ASSERT_EQ(numMisses + 7, database->getNumPlanCacheMisses());
+}
+
+TEST_F(ApiTest, PlanCacheWithParameters) {
+    auto query = "MATCH (a:person) WHERE a.age > $1 RETURN COUNT(*)";
+    auto numHits = database->getNumPlanCacheHits();
+    auto preparedStatement1 = conn->prepare(query);
+    auto preparedStatement2 = conn->prepare(query);
+    ASSERT_EQ(numHits + 1, database->getNumPlanCacheHits());
+    // Both statements share the cached plan but bind their own parameter values.
+    auto result =
+        conn->execute(preparedStatement2.get(), std::make_pair(std::string("1"), (int64_t)40));
+    ASSERT_EQ(result->getNext()->getValue(0)->getValue<int64_t>(), 2);
+    result = conn->execute(preparedStatement1.get(), std::make_pair(std::string("1"), (int64_t)30));
+    ASSERT_EQ(result->getNext()->getValue(0)->getValue<int64_t>(), 4);
+    result = conn->execute(preparedStatement2.get());
+    ASSERT_EQ(result->getNext()->getValue(0)->getValue<int64_t>(), 2);
+}
+
+TEST_F(ApiTest, OrderByStringKeyPrefixLength) {
+    auto query = "MATCH (a:person)-[:knows]->(b:person) RETURN b.fName, a.fName ORDER BY b.fName "
+                 "DESC, a.fName";
+    auto groundTruth =
+        TestHelper::convertResultToString(*conn->query(query), true /* checkOutputOrder */);
+    ASSERT_EQ(groundTruth.size(), 14);
+    // With a 1-byte prefix, most strings are longer than the encoded prefix and ties need to be
+    // broken by comparing the full strings.
+    conn->setOrderByStringKeyPrefixLength(1);
+    ASSERT_EQ(groundTruth,
+        TestHelper::convertResultToString(*conn->query(query), true /* checkOutputOrder */));
+    // With a 64-byte prefix, all strings are fully encoded.
+    conn->setOrderByStringKeyPrefixLength(64);
+    ASSERT_EQ(groundTruth,
+        TestHelper::convertResultToString(*conn->query(query), true /* checkOutputOrder */));
+    // The longest allowed prefix is accepted and still sorts correctly.
+    conn->setOrderByStringKeyPrefixLength(
+        ClientContextConstants::MAX_ORDER_BY_STRING_KEY_PREFIX_LENGTH);
+    ASSERT_EQ(groundTruth,
+        TestHelper::convertResultToString(*conn->query(query), true /* checkOutputOrder */));
+    try {
+        conn->setOrderByStringKeyPrefixLength(0);
+        FAIL();
+    } catch (ConnectionException& e) {}
+    try {
+        conn->setOrderByStringKeyPrefixLength(
+            ClientContextConstants::MAX_ORDER_BY_STRING_KEY_PREFIX_LENGTH + 1);
+        FAIL();
+    } catch (ConnectionException& e) {}
+}
+
+static nlohmann::json* findOperator(nlohmann::json& json, const std::string& name) {
+    if (json["Name"] == name) {
+        return &json;
+    }
+    for (auto i = 0u; json.contains("Child" + std::to_string(i)); ++i) {
+        auto result = findOperator(json["Child" + std::to_string(i)], name);
+        if (result != nullptr) {
+            return result;
+        }
+    }
+    return nullptr;
+}
+
+TEST_F(ApiTest, HashJoinSkipsProbeSideIfBuildSideIsEmpty) {
+    auto result = ApiTest::queryWithEncodedJoin(conn.get(),
+        "PROFILE MATCH (a:person)-[:knows]->(b:person) WHERE b.age > 100 RETURN COUNT(*)",
+        "HJ(a._id){S(a)}{E(a)S(b)}");
+    ASSERT_TRUE(result->isSuccess());
+    auto& plan = ApiTest::getPlanInJson(*result);
+    auto probe = findOperator(plan, "HASH_JOIN_PROBE");
+    ASSERT_NE(probe, nullptr);
+    // The build side finds no person older than 100, so the probe side is never scanned.
+    auto buildSideFilter = findOperator((*probe)["Child1"], "FILTER");
+    ASSERT_NE(buildSideFilter, nullptr);
+    ASSERT_EQ((*buildSideFilter)["NumOutputTuples"], "0");
+    auto probeSideScan = findOperator((*probe)["Child0"], "SCAN_NODE_ID");
+    ASSERT_NE(probeSideScan, nullptr);
+    ASSERT_EQ((*probeSideScan)["NumOutputTuples"], "0");
+}
@@ -1,4 +1,6 @@
 #include "graph_test/graph_test.h"
+#include "optimizer/logical_operator_collector.h"
+#include "planner/logical_plan/logical_operator/logical_extend.h"
 #include "planner/logical_plan/logical_plan_util.h"
 
 namespace kuzu {
@@ -17,6 +19,14 @@ public:
     std::shared_ptr<planner::LogicalOperator> getRoot(const std::string& query) {
         return TestHelper::getLogicalPlan(query, *conn)->getLastOperator();
     }
+
+    bool isCountNbrsOnly(const std::string& query) {
+        auto collector = optimizer::LogicalExtendCollector();
+        collector.collect(getRoot(query).get());
+        auto extends = collector.getOperators();
+        EXPECT_EQ(extends.size(), 1);
+        return ((planner::LogicalExtend*)extends[0])->isCountNbrsOnly();
+    }
 };
 
 TEST_F(OptimizerTest, FilterPushDownTest) {
@@ -68,6 +78,16 @@ TEST_F(OptimizerTest, ProjectionPushDownJoinTest) {
     ASSERT_EQ(op->getOperatorType(), planner::LogicalOperatorType::PROJECTION);
 }
 
+TEST_F(OptimizerTest, UnionAllIdenticalChildrenTest) {
+    // Identical children are evaluated once by the mapper but keep their own operators.
+    auto collector = optimizer::LogicalScanNodeCollector();
+    collector.collect(
+        getRoot("MATCH (a:person) RETURN a.age UNION ALL MATCH (a:person) RETURN a.age;").get());
+    auto scans = collector.getOperators();
+    ASSERT_EQ(scans.size(), 2);
+    ASSERT_NE(scans[0], scans[1]);
+}
+
 TEST_F(OptimizerTest, JoinOrderTest1) {
     auto encodedPlan = getEncodedPlan("MATCH (a:person)-[e:knows]->(b:person) RETURN a.ID, b.ID;");
     ASSERT_STREQ(encodedPlan.c_str(), "HJ(b._id){E(b)S(a)}{S(b)}");
@@ -86,11 +106,28 @@ TEST_F(OptimizerTest, JoinOrderTest3) {
     ASSERT_STREQ(encodedPlan.c_str(), "I(c._id){HJ(b._id){E(b)S(a)}{S(b)}}{E(c)S(a)}{E(c)S(b)}");
 }
 
+TEST_F(OptimizerTest, JoinOrderBySelectivityTest) {
+    // The more selective side of the join is built.
+    auto encodedPlan = getEncodedPlan("MATCH (a:person)-[e:knows]->(b:person) "
+                                      "WHERE NOT a.age = 1 AND b.age < 5 RETURN a.ID, b.ID;");
+    ASSERT_STREQ(encodedPlan.c_str(), "HJ(a._id){S(a)}{E(a)S(b)}");
+    encodedPlan = getEncodedPlan("MATCH (a:person)-[e:knows]->(b:person) "
+                                 "WHERE a.age < 5 AND NOT b.age = 1 RETURN a.ID, b.ID;");
+    ASSERT_STREQ(encodedPlan.c_str(), "HJ(b._id){S(b)}{E(b)S(a)}");
+}
+
 TEST_F(OptimizerTest, RecursiveJoinTest) {
     auto encodedPlan = getEncodedPlan(
         "MATCH (a:person)-[:knows* SHORTEST 1..5]->(b:person) WHERE b.ID < 0 RETURN a.fName;");
     ASSERT_STREQ(encodedPlan.c_str(), "HJ(a._id){S(a)}{RE(a)S(b)}");
 }
 
+TEST_F(OptimizerTest, DegreeTest) {
+    ASSERT_TRUE(isCountNbrsOnly("MATCH (a:person)-[:knows]->(b:person) RETURN a.ID, COUNT(*);"));
+    ASSERT_TRUE(isCountNbrsOnly("MATCH (a:person)-[:knows]->(:person) RETURN SUM(a.age);"));
+    ASSERT_FALSE(isCountNbrsOnly("MATCH (a:person)-[e:knows]->(:person) RETURN COUNT(e.date);"));
+    ASSERT_FALSE(isCountNbrsOnly("MATCH (a:person)-[:knows]->(b:person) RETURN a.ID, b.ID;"));
+}
+
 } // namespace testing
 } // namespace kuzu
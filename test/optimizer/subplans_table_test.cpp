@@ -0,0 +1,115 @@
+#include <algorithm>
+
+#include "binder/expression/property_expression.h"
+#include "gtest/gtest.h"
+#include "planner/logical_plan/logical_operator/logical_scan_node.h"
+#include "planner/subplans_table.h"
+
+using namespace kuzu::binder;
+using namespace kuzu::common;
+using namespace kuzu::planner;
+using ::testing::Test;
+
+class SubPlansTableTest : public Test {
+protected:
+    void SetUp() override {
+        for (auto i = 0u; i < MAX_NUM_QUERY_VARIABLES; ++i) {
+            auto name = "_" + std::to_string(i) + "_n";
+            auto node = std::make_shared<NodeExpression>(name, "n", std::vector<table_id_t>{0});
+            node->setInternalIDProperty(std::make_unique<PropertyExpression>(
+                DataType(INTERNAL_ID), INTERNAL_ID_SUFFIX, *node,
+                std::unordered_map<table_id_t, property_id_t>{{0, INVALID_PROPERTY_ID}},
+                false /* isPrimaryKey */));
+            queryGraph.addQueryNode(std::move(node));
+        }
+    }
+
+    SubqueryGraph getSubgraph(const std::vector<uint32_t>& nodePositions) {
+        auto subgraph = SubqueryGraph(queryGraph);
+        for (auto nodePos : nodePositions) {
+            subgraph.addQueryNode(nodePos);
+        }
+        return subgraph;
+    }
+
+    // Returns a plan over the given nodes, each in its own group. Node nodePositions[i] is flat iff
+    // the i-th bit of flatMask is set.
+    std::unique_ptr<LogicalPlan> getPlan(
+        const std::vector<uint32_t>& nodePositions, uint64_t flatMask, uint64_t cost) {
+        auto scan = std::make_shared<LogicalScanNode>(queryGraph.getQueryNode(nodePositions[0]));
+        scan->computeFactorizedSchema();
+        auto schema = scan->getSchema();
+        for (auto i = 1u; i < nodePositions.size(); ++i) {
+            auto groupPos = schema->createGroup();
+            schema->insertToGroupAndScope(
+                queryGraph.getQueryNode(nodePositions[i])->getInternalIDProperty(), groupPos);
+        }
+        for (auto i = 0u; i < nodePositions.size(); ++i) {
+            if (flatMask & (1ull << i)) {
+                schema->flattenGroup(schema->getGroupPos(
+                    *queryGraph.getQueryNode(nodePositions[i])->getInternalIDProperty()));
+            }
+        }
+        auto plan = std::make_unique<LogicalPlan>();
+        plan->setLastOperator(std::move(scan));
+        plan->setCost(cost);
+        return plan;
+    }
+
+    static std::vector<uint64_t> getSortedCosts(std::vector<std::unique_ptr<LogicalPlan>>& plans) {
+        std::vector<uint64_t> costs;
+        for (auto& plan : plans) {
+            costs.push_back(plan->getCost());
+        }
+        std::sort(costs.begin(), costs.end());
+        return costs;
+    }
+
+protected:
+    QueryGraph queryGraph;
+};
+
+TEST_F(SubPlansTableTest, SubgraphKeepsCheapestPlansTest) {
+    std::vector<uint32_t> nodePositions{0, 1, 2, 3};
+    auto subgraph = getSubgraph(nodePositions);
+    SubgraphPlans subgraphPlans(subgraph);
+    // 16 factorization structures, each cheaper than the previous one. Only 10 plans are kept.
+    for (auto flatMask = 0u; flatMask < 16; ++flatMask) {
+        subgraphPlans.addPlan(getPlan(nodePositions, flatMask, 100 - flatMask));
+    }
+    std::vector<uint64_t> expectedCosts;
+    for (auto cost = 85u; cost < 95; ++cost) {
+        expectedCosts.push_back(cost);
+    }
+    ASSERT_EQ(getSortedCosts(subgraphPlans.getPlans()), expectedCosts);
+    ASSERT_EQ(subgraphPlans.getMinCost(), 85u);
+    ASSERT_EQ(subgraphPlans.getMaxCost(), 94u);
+    // Evicted structures can not come back unless they are cheaper than the most expensive plan.
+    subgraphPlans.addPlan(getPlan(nodePositions, 0 /* flatMask */, 94));
+    ASSERT_EQ(getSortedCosts(subgraphPlans.getPlans()), expectedCosts);
+    // A cheaper plan with a kept structure replaces the plan with the same structure.
+    subgraphPlans.addPlan(getPlan(nodePositions, 6 /* flatMask */, 10));
+    subgraphPlans.addPlan(getPlan(nodePositions, 6 /* flatMask */, 20));
+    expectedCosts.erase(expectedCosts.end() - 1);
+    expectedCosts.insert(expectedCosts.begin(), 10);
+    ASSERT_EQ(getSortedCosts(subgraphPlans.getPlans()), expectedCosts);
+    ASSERT_EQ(subgraphPlans.getMinCost(), 10u);
+    ASSERT_EQ(subgraphPlans.getMaxCost(), 93u);
+}
+
+TEST_F(SubPlansTableTest, DPLevelKeepsCheapestSubgraphsTest) {
+    SubPlansTable subPlansTable;
+    subPlansTable.resize(2);
+    // Each single node subgraph is cheaper than the previous one. Only 50 subgraphs are kept.
+    for (auto nodePos = 0u; nodePos < MAX_NUM_QUERY_VARIABLES; ++nodePos) {
+        subPlansTable.addPlan(getSubgraph({nodePos}),
+            getPlan({nodePos}, 0 /* flatMask */, MAX_NUM_QUERY_VARIABLES - nodePos));
+    }
+    auto subgraphs = subPlansTable.getSubqueryGraphs(1);
+    ASSERT_EQ(subgraphs.size(), 50u);
+    for (auto nodePos = 0u; nodePos < MAX_NUM_QUERY_VARIABLES; ++nodePos) {
+        ASSERT_EQ(subPlansTable.containSubgraphPlans(getSubgraph({nodePos})), nodePos >= 14);
+    }
+    // A new subgraph must be cheaper than the most expensive kept subgraph.
+    ASSERT_EQ(subPlansTable.getMaxCost(getSubgraph({0})), 50u);
+}
@@ -534,3 +534,67 @@ TEST_F(KeyBlockMergerTest, multipleStrKeyColsTest) {
         orderByKeyEncoder1.getNumBytesPerTuple(), expectedBlockOffsetOrder,
         expectedFactorizedTableIdxOrder);
 }
+
+TEST_F(KeyBlockMergerTest, mergePathMorselTest) {
+    // The left key block holds 0-10239 and the right key block holds 5120-15359, so the two
+    // blocks only partially interleave and share some values.
+    auto numValuesPerBlock = 5 * DEFAULT_VECTOR_CAPACITY;
+    std::vector<std::shared_ptr<DataChunk>> dataChunks;
+    std::vector<std::vector<ValueVector*>> orderByVectors(2);
+    std::vector<bool> isAscOrder = {true};
+    std::vector<std::unique_ptr<OrderByKeyEncoder>> encoders;
+    for (auto ftIdx = 0u; ftIdx < 2; ftIdx++) {
+        auto dataChunk = std::make_shared<DataChunk>(1);
+        auto valueVector = std::make_shared<ValueVector>(INT64, memoryManager.get());
+        dataChunk->insert(0, valueVector);
+        dataChunk->state->initOriginalAndSelectedSize(DEFAULT_VECTOR_CAPACITY);
+        orderByVectors[ftIdx].push_back(valueVector.get());
+        encoders.push_back(std::make_unique<OrderByKeyEncoder>(orderByVectors[ftIdx], isAscOrder,
+            memoryManager.get(), ftIdx, numTuplesPerBlockInFT,
+            OrderByKeyEncoder::getNumBytesPerTuple(orderByVectors[ftIdx])));
+        for (auto i = 0u; i < numValuesPerBlock; i += DEFAULT_VECTOR_CAPACITY) {
+            for (auto j = 0u; j < DEFAULT_VECTOR_CAPACITY; j++) {
+                valueVector->setValue<int64_t>(j, ftIdx * numValuesPerBlock / 2 + i + j);
+            }
+            encoders[ftIdx]->encodeKeys();
+        }
+        dataChunks.push_back(std::move(dataChunk));
+    }
+
+    std::vector<std::shared_ptr<FactorizedTable>> factorizedTables;
+    std::vector<StrKeyColInfo> strKeyColsInfo;
+    auto numBytesPerEntry = encoders[0]->getNumBytesPerTuple();
+    KeyBlockMerger keyBlockMerger =
+        KeyBlockMerger(factorizedTables, strKeyColsInfo, numBytesPerEntry);
+    auto resultKeyBlock = std::make_shared<MergedKeyBlocks>(
+        numBytesPerEntry, 2 * numValuesPerBlock, memoryManager.get());
+    auto keyBlockMergeTask = std::make_shared<KeyBlockMergeTask>(
+        std::make_shared<MergedKeyBlocks>(numBytesPerEntry, encoders[0]->getKeyBlocks()[0]),
+        std::make_shared<MergedKeyBlocks>(numBytesPerEntry, encoders[1]->getKeyBlocks()[0]),
+        resultKeyBlock, keyBlockMerger);
+    // Every morsel except the last one produces exactly batch_size tuples of the result.
+    auto numMergedTuples = 0u;
+    while (keyBlockMergeTask->hasMorselLeft()) {
+        auto morsel = keyBlockMergeTask->getMorsel();
+        morsel->keyBlockMergeTask = keyBlockMergeTask;
+        auto numTuplesInMorsel = morsel->leftKeyBlockEndIdx - morsel->leftKeyBlockStartIdx +
+                                 morsel->rightKeyBlockEndIdx - morsel->rightKeyBlockStartIdx;
+        ASSERT_EQ(numTuplesInMorsel, std::min((uint64_t)KeyBlockMergeTask::batch_size,
+                                         resultKeyBlock->getNumTuples() - numMergedTuples));
+        keyBlockMerger.mergeKeyBlocks(*morsel);
+        numMergedTuples += numTuplesInMorsel;
+    }
+    ASSERT_EQ(numMergedTuples, 2 * numValuesPerBlock);
+    // The result is sorted, and ties are resolved in favour of the left key block.
+    auto tupleInfoOffset = numBytesPerEntry - sizeof(uint64_t);
+    for (auto i = 1u; i < resultKeyBlock->getNumTuples(); i++) {
+        auto prevTuple = resultKeyBlock->getTuple(i - 1);
+        auto curTuple = resultKeyBlock->getTuple(i);
+        auto result = memcmp(prevTuple, curTuple, tupleInfoOffset);
+        ASSERT_LE(result, 0);
+        if (result == 0) {
+            ASSERT_EQ(OrderByKeyEncoder::getEncodedFTIdx(prevTuple + tupleInfoOffset), 0);
+            ASSERT_EQ(OrderByKeyEncoder::getEncodedFTIdx(curTuple + tupleInfoOffset), 1);
+        }
+    }
+}
@@ -486,6 +486,47 @@ TEST_F(OrderByKeyEncoderTest, singleOrderByColStringUnflatTest) {
     checkTupleIdxAndFactorizedTableIdx(3, keyBlockPtr);
 }
 
+TEST_F(OrderByKeyEncoderTest, singleOrderByColStringWithCustomPrefixLengthTest) {
+    std::shared_ptr<DataChunk> dataChunk = std::make_shared<DataChunk>(1);
+    dataChunk->state->selVector->selectedSize = 3;
+    std::shared_ptr<ValueVector> stringValueVector =
+        std::make_shared<ValueVector>(STRING, memoryManager.get());
+    stringValueVector->setValue<std::string>(0, "commonprefix string1"); // fits into the prefix
+    stringValueVector->setValue<std::string>(1, "commonprefix string12"); // longer than the prefix
+    stringValueVector->setNull(2, true);
+    dataChunk->insert(0, stringValueVector);
+    std::vector<ValueVector*> valueVectors;
+    valueVectors.emplace_back(stringValueVector.get());
+    auto isAscOrder = std::vector<bool>(1, false);
+    auto strKeyPrefixLength = 20u;
+    ASSERT_EQ(OrderByKeyEncoder::getEncodingSize(DataType(STRING), strKeyPrefixLength), 22);
+    auto orderByKeyEncoder = OrderByKeyEncoder(valueVectors, isAscOrder, memoryManager.get(), ftIdx,
+        numTuplesPerBlockInFT,
+        OrderByKeyEncoder::getNumBytesPerTuple(valueVectors, strKeyPrefixLength),
+        strKeyPrefixLength);
+    orderByKeyEncoder.encodeKeys();
+    uint8_t* keyBlockPtr = orderByKeyEncoder.getKeyBlocks()[0]->getData();
+
+    // Check encoding for: NULL FLAG(0x00) + the first 20 bytes of the string + LONG STRING FLAG.
+    // All bytes are flipped because the column is in desc order.
+    for (auto i = 0u; i < 2; i++) {
+        auto expectedStr = std::string("commonprefix string1");
+        checkNonNullFlag(keyBlockPtr, isAscOrder[0]);
+        ASSERT_TRUE(OrderByKeyEncoder::isLongStr(keyBlockPtr - 1, isAscOrder[0],
+                        strKeyPrefixLength) == (i == 1));
+        for (auto j = 0u; j < strKeyPrefixLength; j++) {
+            ASSERT_EQ(*(keyBlockPtr++), (uint8_t)~expectedStr[j]);
+        }
+        checkLongStrFlag(keyBlockPtr, isAscOrder[0], i == 1 /* isLongStr */);
+        checkTupleIdxAndFactorizedTableIdx(i, keyBlockPtr);
+    }
+
+    for (auto i = 0u; i < strKeyPrefixLength + 2; i++) {
+        ASSERT_EQ(*(keyBlockPtr++), 0x00);
+    }
+    checkTupleIdxAndFactorizedTableIdx(2, keyBlockPtr);
+}
+
 TEST_F(OrderByKeyEncoderTest, singleOrderByColDoubleUnflatTest) {
     std::shared_ptr<DataChunk> dataChunk = std::make_shared<DataChunk>(1);
     dataChunk->state->selVector->selectedSize = 6;
@@ -0,0 +1,146 @@
+#include "common/constants.h"
+#include "common/data_chunk/data_chunk.h"
+#include "gtest/gtest.h"
+#include "processor/result/factorized_table.h"
+
+using ::testing::Test;
+using namespace kuzu::common;
+using namespace kuzu::processor;
+using namespace kuzu::storage;
+
+class FactorizedTableTest : public Test {
+
+public:
+    void SetUp() override {
+        LoggerUtils::createLogger(LoggerConstants::LoggerEnum::BUFFER_MANAGER);
+        LoggerUtils::createLogger(LoggerConstants::LoggerEnum::STORAGE);
+        bufferManager = std::make_unique<BufferManager>(
+            BufferPoolConstants::DEFAULT_BUFFER_POOL_SIZE_FOR_TESTING);
+        memoryManager = std::make_unique<MemoryManager>(bufferManager.get());
+        dataChunk = std::make_shared<DataChunk>(1);
+        vector = std::make_shared<ValueVector>(INT64, memoryManager.get());
+        dataChunk->insert(0, vector);
+    }
+
+    void TearDown() override {
+        LoggerUtils::dropLogger(LoggerConstants::LoggerEnum::BUFFER_MANAGER);
+        LoggerUtils::dropLogger(LoggerConstants::LoggerEnum::STORAGE);
+    }
+
+    std::unique_ptr<FactorizedTable> getInt64Table(bool columnar = false) {
+        auto tableSchema = std::make_unique<FactorizedTableSchema>();
+        tableSchema->appendColumn(std::make_unique<ColumnSchema>(
+            false /* isUnflat */, 0 /* dataChunkPos */, sizeof(int64_t)));
+        tableSchema->setColumnar(columnar);
+        return std::make_unique<FactorizedTable>(memoryManager.get(), std::move(tableSchema));
+    }
+
+    // Appends the values [startValue, startValue + numValues) to the table. If withNulls is set,
+    // odd values are appended as nulls.
+    void appendInt64Values(
+        FactorizedTable& table, int64_t startValue, uint64_t numValues, bool withNulls = false) {
+        std::vector<ValueVector*> vectorsToAppend{vector.get()};
+        while (numValues > 0) {
+            auto numValuesToAppend = std::min(numValues, DEFAULT_VECTOR_CAPACITY);
+            for (auto i = 0u; i < numValuesToAppend; i++) {
+                vector->setValue<int64_t>(i, startValue + i);
+                vector->setNull(i, withNulls && (startValue + i) % 2 == 1);
+            }
+            dataChunk->state->selVector->selectedSize = numValuesToAppend;
+            table.append(vectorsToAppend);
+            startValue += numValuesToAppend;
+            numValues -= numValuesToAppend;
+        }
+    }
+
+    void checkInt64Values(FactorizedTable& table, uint64_t numValues, bool withNulls = false) {
+        ASSERT_EQ(table.getNumTuples(), numValues);
+        std::vector<ValueVector*> vectorsToScan{vector.get()};
+        for (auto tupleIdx = 0u; tupleIdx < numValues; tupleIdx += DEFAULT_VECTOR_CAPACITY) {
+            auto numTuplesToScan = std::min(numValues - tupleIdx, DEFAULT_VECTOR_CAPACITY);
+            table.scan(vectorsToScan, tupleIdx, numTuplesToScan);
+            for (auto i = 0u; i < numTuplesToScan; i++) {
+                auto isNull = withNulls && (tupleIdx + i) % 2 == 1;
+                ASSERT_EQ(vector->isNull(i), isNull);
+                if (!isNull) {
+                    ASSERT_EQ(vector->getValue<int64_t>(i), (int64_t)(tupleIdx + i));
+                }
+            }
+        }
+    }
+
+public:
+    std::unique_ptr<BufferManager> bufferManager;
+    std::unique_ptr<MemoryManager> memoryManager;
+    std::shared_ptr<DataChunk> dataChunk;
+    std::shared_ptr<ValueVector> vector;
+};
+
+TEST_F(FactorizedTableTest, MergeInOrderTest) {
+    auto table = getInt64Table();
+    auto numTuplesPerBlock = table->getNumTuplesPerBlock();
+    // The last block of each table is partially filled, so the tuples of the merged tables have
+    // to be shifted.
+    std::vector<uint64_t> numTuplesToMerge{
+        numTuplesPerBlock + 100, 2 * numTuplesPerBlock - 50, 10, numTuplesPerBlock};
+    auto numTuples = 0ul;
+    for (auto numTuplesInTable : numTuplesToMerge) {
+        auto otherTable = getInt64Table();
+        appendInt64Values(*otherTable, numTuples, numTuplesInTable);
+        table->mergeInOrder(*otherTable);
+        numTuples += numTuplesInTable;
+    }
+    checkInt64Values(*table, numTuples);
+}
+
+TEST_F(FactorizedTableTest, ColumnarLayoutTest) {
+    auto table = getInt64Table(true /* columnar */);
+    auto numTuplesPerBlock = table->getNumTuplesPerBlock();
+    auto numTuples = 2 * numTuplesPerBlock + 100;
+    appendInt64Values(*table, 0 /* startValue */, numTuples, true /* withNulls */);
+    checkInt64Values(*table, numTuples, true /* withNulls */);
+    for (auto tupleIdx : std::vector<uint64_t>{0, 1, numTuplesPerBlock, numTuples - 1}) {
+        ASSERT_EQ(table->isNonOverflowColNull(table->getNullMapPtr(tupleIdx), 0 /* colIdx */),
+            tupleIdx % 2 == 1);
+        if (tupleIdx % 2 == 0) {
+            ASSERT_EQ(*(int64_t*)table->getCellPtr(tupleIdx, 0 /* colIdx */), (int64_t)tupleIdx);
+        }
+    }
+    auto value = Value::createDefaultValue(DataType(INT64));
+    FlatTupleIterator iterator{*table, std::vector<Value*>{&value}};
+    for (auto i = 0u; i < numTuples; i++) {
+        ASSERT_TRUE(iterator.hasNextFlatTuple());
+        iterator.getNextFlatTuple();
+        ASSERT_EQ(value.isNull(), i % 2 == 1);
+        if (i % 2 == 0) {
+            ASSERT_EQ(value.getValue<int64_t>(), (int64_t)i);
+        }
+    }
+    ASSERT_FALSE(iterator.hasNextFlatTuple());
+}
+
+TEST_F(FactorizedTableTest, ColumnarMergeTest) {
+    auto table = getInt64Table(true /* columnar */);
+    auto numTuplesPerBlock = table->getNumTuplesPerBlock();
+    std::vector<uint64_t> numTuplesToMerge{numTuplesPerBlock + 100, 10, numTuplesPerBlock};
+    auto numTuples = 0ul;
+    for (auto numTuplesInTable : numTuplesToMerge) {
+        auto otherTable = getInt64Table(true /* columnar */);
+        appendInt64Values(*otherTable, numTuples, numTuplesInTable, true /* withNulls */);
+        table->mergeInOrder(*otherTable);
+        numTuples += numTuplesInTable;
+    }
+    checkInt64Values(*table, numTuples, true /* withNulls */);
+    // Merging without preserving the order moves tuples of the other table's partially filled
+    // block, so only check the number of non-null values.
+    auto otherTable = getInt64Table(true /* columnar */);
+    appendInt64Values(
+        *otherTable, 0 /* startValue */, numTuplesPerBlock + 10, true /* withNulls */);
+    table->merge(*otherTable);
+    ASSERT_EQ(table->getNumTuples(), numTuples + numTuplesPerBlock + 10);
+    auto numNonNullValues = 0ul;
+    for (auto i = 0u; i < table->getNumTuples(); i++) {
+        numNonNullValues += !table->isNonOverflowColNull(table->getNullMapPtr(i), 0 /* colIdx */);
+    }
+    ASSERT_EQ(numNonNullValues, (numTuples + 1) / 2 + (numTuplesPerBlock + 11) / 2);
+}
@@ -19,3 +19,20 @@ TEST_F(OrderByTests, OrderByLargeDatasetTest) {
     }
     ASSERT_TRUE(TestHelper::testQueries(queryConfigs, *conn));
 }
+
+TEST_F(OrderByTests, OrderByMultipleScanMorselsInParallelTest) {
+    // The 3000 * 50 sorted tuples are more than SCAN_MORSEL_SIZE (65536), so they are scanned in
+    // several morsels by 4 threads. Result collection must keep the order across morsels.
+    conn->setMaxNumThreadForExec(4);
+    auto result = conn->query("MATCH (a:person), (b:person) WHERE b.ID < 50 RETURN a.ID, b.ID "
+                              "ORDER BY a.ID DESC, b.ID");
+    ASSERT_TRUE(result->isSuccess());
+    auto numTuples = 3000 * 50;
+    for (auto i = 0; i < numTuples; ++i) {
+        ASSERT_TRUE(result->hasNext());
+        auto tuple = result->getNext();
+        ASSERT_EQ(tuple->getValue(0)->getValue<int64_t>(), 2999 - i / 50);
+        ASSERT_EQ(tuple->getValue(1)->getValue<int64_t>(), i % 50);
+    }
+    ASSERT_FALSE(result->hasNext());
+}
@@ -205,3 +205,55 @@ TEST_F(SetNodeStructuredPropTransactionTest, SetManyNodeLongStringPropRollbackTe
     auto result = conn->query("MATCH (a:person) WHERE a.ID=0 RETURN a.fName");
     ASSERT_EQ(result->getNext()->getValue(0)->getValue<std::string>(), "Alice");
 }
+
+// The dataset has 10000 person nodes, i.e., 5 morsels of the node scan.
+class SetNodePropInParallelTest : public BaseSetNodePropTransactionTest {
+public:
+    std::string getInputDir() override {
+        return TestHelper::appendKuzuRootPath("dataset/node-insertion-deletion-tests/int64-pk/");
+    }
+};
+
+TEST_F(SetNodePropInParallelTest, SetScannedNodePropInParallelCommitTest) {
+    conn->query("ALTER TABLE person ADD age INT64 DEFAULT 0");
+    conn->setMaxNumThreadForExec(4);
+    conn->beginWriteTransaction();
+    ASSERT_TRUE(conn->query("MATCH (a:person) SET a.age = a.ID * 2")->isSuccess());
+    ASSERT_TRUE(conn->query("MATCH (a:person) SET a.age = a.age + 1")->isSuccess());
+    conn->commit();
+    auto result = readConn->query("MATCH (a:person) WHERE a.age <> a.ID * 2 + 1 RETURN count(*)");
+    ASSERT_EQ(result->getNext()->getValue(0)->getValue<int64_t>(), 0);
+    result = readConn->query("MATCH (a:person) RETURN sum(a.age)");
+    ASSERT_EQ(result->getNext()->getValue(0)->getValue<int64_t>(), 2 * 49995000 + 10000);
+}
+
+// p1-p5000 all have an edge to p5000, so p5000 is updated from many rows.
+class SetNodePropOfRepeatedNodesTest : public BaseSetNodePropTransactionTest {
+public:
+    std::string getInputDir() override {
+        return TestHelper::appendKuzuRootPath("dataset/read-list-tests/large-list/");
+    }
+
+    std::vector<std::string> incrementNumIncomingAndRollback(uint64_t numThreads) {
+        conn->setMaxNumThreadForExec(numThreads);
+        conn->beginWriteTransaction();
+        auto result = conn->query("MATCH (a:person)-[:knows]->(b:person) WHERE a.ID > 0 SET "
+                                  "b.numIncoming = b.numIncoming + 1");
+        EXPECT_TRUE(result->isSuccess());
+        result = conn->query("MATCH (b:person) RETURN b.ID, b.numIncoming");
+        auto resultStr = TestHelper::convertResultToString(*result);
+        conn->rollback();
+        sort(resultStr.begin(), resultStr.end());
+        return resultStr;
+    }
+};
+
+TEST_F(SetNodePropOfRepeatedNodesTest, SetRepeatedNodePropTest) {
+    conn->query("ALTER TABLE person ADD numIncoming INT64 DEFAULT 0");
+    // Updates of the same node must not be lost when the query runs with more threads.
+    auto singleThreadResult = incrementNumIncomingAndRollback(1 /* numThreads */);
+    auto multiThreadResult = incrementNumIncomingAndRollback(4 /* numThreads */);
+    ASSERT_EQ(singleThreadResult, multiThreadResult);
+    auto result = conn->query("MATCH (b:person) WHERE b.numIncoming <> 0 RETURN count(*)");
+    ASSERT_EQ(result->getNext()->getValue(0)->getValue<int64_t>(), 0);
+}
@@ -6,9 +6,35 @@ using namespace kuzu::storage;
 using namespace kuzu::testing;
 
 class WALReplayerTests : public DBTest {
+public:
     std::string getInputDir() override {
         return TestHelper::appendKuzuRootPath("dataset/tinysnb/");
     }
+
+    // Updates every person numUpdates times in one write transaction. Each update writes a new
+    // long string to the fName overflow file, so the WAL ends up with more pages of that file than
+    // fit into one checkpoint write.
+    void updatePersonsInOneTransaction(uint64_t numUpdates) {
+        conn->beginWriteTransaction();
+        for (auto i = 0u; i < numUpdates; ++i) {
+            auto result = conn->query("MATCH (a:person) SET a.age = a.age + 1, a.fName = concat('" +
+                                      getLongStringPrefix() + "', string(a.ID + " +
+                                      std::to_string(i) + "))");
+            ASSERT_TRUE(result->isSuccess());
+        }
+    }
+
+    void checkPersonsAfterUpdates(uint64_t numUpdates) {
+        auto result = conn->query("MATCH (a:person) WHERE a.ID = 0 RETURN a.age, a.fName");
+        auto tuple = result->getNext();
+        ASSERT_EQ(tuple->getValue(0)->getValue<int64_t>(), (int64_t)(35 + numUpdates));
+        ASSERT_EQ(tuple->getValue(1)->getValue<std::string>(),
+            getLongStringPrefix() + std::to_string(numUpdates - 1));
+        result = conn->query("MATCH (a:person) RETURN count(*)");
+        ASSERT_EQ(result->getNext()->getValue(0)->getValue<int64_t>(), 8);
+    }
+
+    static inline std::string getLongStringPrefix() { return std::string(200, 'a'); }
 };
 
 TEST_F(WALReplayerTests, ReplayingUncommittedWALForChekpointErrors) {
@@ -21,3 +47,26 @@ TEST_F(WALReplayerTests, ReplayingUncommittedWALForChekpointErrors) {
     } catch (StorageException& e) {
     } catch (Exception& e) { FAIL(); }
 }
+
+TEST_F(WALReplayerTests, RecoverCommittedWALTest) {
+    auto numUpdates = 1000u;
+    updatePersonsInOneTransaction(numUpdates);
+    commitButSkipCheckpointingForTestingRecovery(*conn);
+    ASSERT_FALSE(getWAL(*database)->isEmptyWAL());
+    // Reopening the database replays the WAL as if the database crashed before checkpointing.
+    createDBAndConn();
+    ASSERT_TRUE(getWAL(*database)->isEmptyWAL());
+    checkPersonsAfterUpdates(numUpdates);
+}
+
+TEST_F(WALReplayerTests, RecoverCommittedWALInParallelTest) {
+    auto numUpdates = 1000u;
+    updatePersonsInOneTransaction(numUpdates);
+    commitButSkipCheckpointingForTestingRecovery(*conn);
+    // The WAL holds pages of the age column, the fName column and the fName overflow file. Pages
+    // of different files are copied back by different threads of the recovery task scheduler.
+    systemConfig->maxNumThreads = 4;
+    createDBAndConn();
+    ASSERT_TRUE(getWAL(*database)->isEmptyWAL());
+    checkPersonsAfterUpdates(numUpdates);
+}
@@ -64,6 +64,23 @@ TEST_F(TransactionManagerTest, MultipleWriteTransactionsErrors) {
     } catch (TransactionManagerException& e) {}
 }
 
+TEST_F(TransactionManagerTest, WriteTransactionWaitsForActiveWriteTransaction) {
+    std::unique_ptr<Transaction> trx1 = transactionManager->beginWriteTransaction();
+    std::thread committer([&] {
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+        transactionManager->commit(trx1.get());
+    });
+    std::unique_ptr<Transaction> trx2 =
+        transactionManager->beginWriteTransaction(10000000 /* 10s */);
+    committer.join();
+    ASSERT_EQ(trx1->getID() + 1, trx2->getID());
+    ASSERT_EQ(trx2->getID(), transactionManager->getActiveWriteTransactionID());
+    try {
+        transactionManager->beginWriteTransaction(1000 /* 1ms */);
+        FAIL();
+    } catch (TransactionManagerException& e) {}
+}
+
 TEST_F(TransactionManagerTest, MultipleCommitsAndRollbacks) {
     // At TransactionManager level, we disallow multiple commit/rollbacks on a write transaction.
     try {
@@ -132,11 +132,9 @@ void PyConnection::getAllEdgesForTorchGeometric(py::array_t<int64_t>& npArray,
         auto tableSchema = table->getTableSchema();
         if (tableSchema->getColumn(0)->isFlat() && !tableSchema->getColumn(1)->isFlat()) {
             for (auto i = 0u; i < table->getNumTuples(); ++i) {
-                auto tuple = table->getTuple(i);
-                auto overflowValue =
-                    (kuzu::common::overflow_value_t*)(tuple + tableSchema->getColOffset(1));
+                auto overflowValue = (kuzu::common::overflow_value_t*)table->getCellPtr(i, 1);
                 for (auto j = 0u; j < overflowValue->numElements; ++j) {
-                    srcBuffer[j] = *(int64_t*)(tuple + tableSchema->getColOffset(0));
+                    srcBuffer[j] = *(int64_t*)table->getCellPtr(i, 0);
                 }
                 for (auto j = 0u; j < overflowValue->numElements; ++j) {
                     dstBuffer[j] = ((int64_t*)overflowValue->value)[j];
@@ -146,14 +144,12 @@ void PyConnection::getAllEdgesForTorchGeometric(py::array_t<int64_t>& npArray,
             }
         } else if (tableSchema->getColumn(1)->isFlat() && !tableSchema->getColumn(0)->isFlat()) {
             for (auto i = 0u; i < table->getNumTuples(); ++i) {
-                auto tuple = table->getTuple(i);
-                auto overflowValue =
-                    (kuzu::common::overflow_value_t*)(tuple + tableSchema->getColOffset(0));
+                auto overflowValue = (kuzu::common::overflow_value_t*)table->getCellPtr(i, 0);
                 for (auto j = 0u; j < overflowValue->numElements; ++j) {
                     srcBuffer[j] = ((int64_t*)overflowValue->value)[j];
                 }
                 for (auto j = 0u; j < overflowValue->numElements; ++j) {
-                    dstBuffer[j] = *(int64_t*)(tuple + tableSchema->getColOffset(1));
+                    dstBuffer[j] = *(int64_t*)table->getCellPtr(i, 1);
                 }
                 srcBuffer += overflowValue->numElements;
                 dstBuffer += overflowValue->numElements;
@@ -395,6 +395,9 @@ void EmbeddedShell::printExecutionResult(QueryResult& queryResult) const {
             printf("==============================================\n");
             printf("=============== Profiler Summary =============\n");
             printf("==============================================\n");
+            printf("Compiling: %.2fms (parsing), %.2fms (binding), %.2fms (planning)\n",
+                querySummary->getParsingTime(), querySummary->getBindingTime(),
+                querySummary->getPlanningTime());
             printf(">> plan\n");
             printf("%s", querySummary->getPlanAsOstream().str().c_str());
         }